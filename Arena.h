@@ -0,0 +1,224 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_ARENA_H
+#define LINEARALG_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Монотонная арена: память выдаётся сдвигом указателя в текущем блоке, освобождается только вся сразу
+// откатом к сохранённой отметке. Блоки после отката не возвращаются системе и используются снова,
+// поэтому повторяющиеся вычисления после первого прохода вообще не обращаются к malloc.
+class Arena {
+ public:
+  struct Mark {
+    size_t block;
+    size_t offset;
+  };
+
+  void *allocate(size_t bytes, size_t alignment) {
+    while (true) {
+      if (current_ < blocks_.size()) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(blocks_[current_].data.get());
+        uintptr_t aligned = (base + offset_ + alignment - 1) / alignment * alignment;
+        if (aligned + bytes <= base + blocks_[current_].size) {
+          offset_ = aligned + bytes - base;
+          return reinterpret_cast<void *>(aligned);
+        }
+        if (current_ + 1 < blocks_.size()) {
+          current_++;
+          offset_ = 0;
+          continue;
+        }
+      }
+      // Каждый новый блок вдвое больше предыдущего, так что блоков остаётся мало
+      size_t size = std::max(bytes + alignment, blocks_.empty() ? FIRST_BLOCK_SIZE : blocks_.back().size * 2);
+      blocks_.push_back({std::unique_ptr<char[]>(new char[size]), size});
+      current_ = blocks_.size() - 1;
+      offset_ = 0;
+    }
+  }
+
+  bool owns(const void *pointer) const {
+    uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+    for (const Block &block : blocks_) {
+      uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+      if (address >= base && address < base + block.size) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Mark mark() const {
+    return {current_, offset_};
+  }
+
+  void rewind(Mark mark) {
+    current_ = mark.block;
+    offset_ = mark.offset;
+  }
+
+ private:
+  static constexpr size_t FIRST_BLOCK_SIZE = 1 << 16;
+
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+  std::vector<Block> blocks_;
+  size_t current_ = 0;
+  size_t offset_ = 0;
+};
+
+// Арена текущего потока и стек открытых в нём ArenaScope. Для каждой области считается, сколько выделенных
+// из неё буферов ещё живы, и у каждой есть свой номер, чтобы аллокатор закрытой области не спутать с новой
+struct ArenaState {
+  struct Level {
+    size_t id;
+    size_t live;
+    // Из вложенной области вынесли значение, и его буферы лежат за отметкой этой области
+    bool escaped;
+  };
+
+  Arena arena;
+  std::vector<Level> levels;
+  size_t next_id = 0;
+};
+
+inline ArenaState &arena_state() {
+  thread_local ArenaState state;
+  return state;
+}
+
+// Арена текущего потока, если в нём открыт ArenaScope, иначе nullptr
+inline Arena *active_arena() {
+  ArenaState &state = arena_state();
+  return state.levels.empty() ? nullptr : &state.arena;
+}
+
+// Пока объект жив, Matrix, Polynomial и Permutation, созданные в этом потоке, берут память из арены потока,
+// а при его уничтожении всё выделенное внутри освобождается разом. Области можно вкладывать друг в друга.
+// Присваивание объекту, созданному снаружи, копирует элементы в его память, так результат и выносят из области.
+// Если значение всё же пережило область (например, его вернули из функции), область видит живые буферы
+// и арену не откатывает, как и все внешние области: значение остаётся верным, а память - занятой.
+class ArenaScope {
+ public:
+  ArenaScope()
+          : mark_(arena_state().arena.mark()) {
+    ArenaState &state = arena_state();
+    state.levels.push_back({state.next_id++, 0, false});
+  }
+
+  ArenaScope(const ArenaScope &other) = delete;
+
+  ArenaScope &operator=(const ArenaScope &other) = delete;
+
+  ~ArenaScope() {
+    ArenaState &state = arena_state();
+    ArenaState::Level level = state.levels.back();
+    state.levels.pop_back();
+    if (level.live == 0 && !level.escaped) {
+      state.arena.rewind(mark_);
+    } else if (!state.levels.empty()) {
+      state.levels.back().escaped = true;
+    }
+  }
+
+ private:
+  Arena::Mark mark_;
+};
+
+// Аллокатор контейнеров библиотеки. Созданный внутри ArenaScope запоминает эту область и, пока она самая
+// внутренняя, выделяет из арены потока. Пока открыта вложенная область, он берёт память из кучи: буфер
+// за отметкой вложенной области пропал бы при её откате. Вне областей и в других потоках это std::allocator.
+// Аллокаторы разных областей не равны, поэтому перемещающее присваивание между ними копирует элементы,
+// а не забирает буфер, который умрёт вместе со своей областью.
+template<typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  // Копия и перемещённый в чужой объект буфер не должны оставаться в арене, которая может умереть раньше
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  ArenaAllocator() {
+    ArenaState &state = arena_state();
+    if (!state.levels.empty()) {
+      state_ = &state;
+      scope_ = state.levels.back().id;
+      depth_ = state.levels.size();
+    }
+  }
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other)
+          : state_(other.state_), scope_(other.scope_), depth_(other.depth_) {
+  }
+
+  T *allocate(size_t count) {
+    ArenaState::Level *level = open_level();
+    if (level != nullptr && depth_ == state_->levels.size()) {
+      level->live++;
+      return static_cast<T *>(state_->arena.allocate(count * sizeof(T), alignof(T)));
+    }
+    return static_cast<T *>(::operator new(count * sizeof(T)));
+  }
+
+  // Память арены возвращается только откатом, здесь лишь уменьшается счётчик живых буферов области
+  void deallocate(T *pointer, size_t) {
+    if (state_ == nullptr || !state_->arena.owns(pointer)) {
+      ::operator delete(pointer);
+      return;
+    }
+    if (ArenaState::Level *level = open_level()) {
+      level->live--;
+    }
+  }
+
+  // Копия контейнера берёт память там, где она создаётся, а не там, где жил оригинал
+  ArenaAllocator select_on_container_copy_construction() const {
+    return ArenaAllocator();
+  }
+
+  template<typename U>
+  friend bool operator==(const ArenaAllocator &lhs, const ArenaAllocator<U> &rhs) {
+    return lhs.state_ == rhs.state_ && lhs.scope_ == rhs.scope_;
+  }
+
+  template<typename U>
+  friend bool operator!=(const ArenaAllocator &lhs, const ArenaAllocator<U> &rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  template<typename U>
+  friend class ArenaAllocator;
+
+  ArenaState *state_ = nullptr;
+  size_t scope_ = 0;
+  size_t depth_ = 0;
+
+  // Уровень области этого аллокатора, если она ещё открыта и это поток, в котором она открыта
+  ArenaState::Level *open_level() const {
+    if (state_ == nullptr || state_ != &arena_state() || state_->levels.size() < depth_) {
+      return nullptr;
+    }
+    ArenaState::Level &level = state_->levels[depth_ - 1];
+    return level.id == scope_ ? &level : nullptr;
+  }
+};
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif //LINEARALG_ARENA_H
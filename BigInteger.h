@@ -0,0 +1,375 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_BIGINTEGER_H
+#define LINEARALG_BIGINTEGER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Целое произвольной длины: знак и модуль в системе счисления 2^32, младшие разряды первыми.
+// Нужен там, где ответ точных алгоритмов не помещается в long long, поэтому умножение и деление
+// школьные: для чисел в несколько тысяч бит этого достаточно.
+class BigInteger {
+ public:
+  BigInteger(long long value = 0) : negative_(value < 0) {
+    unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value)
+                                             : static_cast<unsigned long long>(value);
+    while (magnitude != 0) {
+      magnitude_.push_back(static_cast<uint32_t>(magnitude));
+      magnitude >>= 32;
+    }
+  }
+
+  bool is_zero() const {
+    return magnitude_.empty();
+  }
+
+  bool negative() const {
+    return negative_;
+  }
+
+  size_t bit_length() const {
+    if (magnitude_.empty()) {
+      return 0;
+    }
+    return 32 * magnitude_.size() - __builtin_clz(magnitude_.back());
+  }
+
+  bool fits_long_long() const {
+    if (bit_length() < 64) {
+      return true;
+    }
+    // -2^63 - единственное 64-битное по модулю значение, которое помещается
+    return negative_ && bit_length() == 64 && magnitude_[1] == (1u << 31) && magnitude_[0] == 0;
+  }
+
+  // Младшие 64 бита со знаком; осмысленно, только если fits_long_long()
+  explicit operator long long() const {
+    unsigned long long magnitude = 0;
+    for (size_t i = std::min<size_t>(magnitude_.size(), 2); i-- > 0;) {
+      magnitude = magnitude << 32 | magnitude_[i];
+    }
+    return static_cast<long long>(negative_ ? 0ULL - magnitude : magnitude);
+  }
+
+  // Остаток из [0, modulus)
+  uint32_t residue(uint32_t modulus) const {
+    uint64_t rest = 0;
+    for (size_t i = magnitude_.size(); i-- > 0;) {
+      rest = ((rest << 32) | magnitude_[i]) % modulus;
+    }
+    return static_cast<uint32_t>(negative_ && rest != 0 ? modulus - rest : rest);
+  }
+
+  BigInteger operator-() const {
+    BigInteger result = *this;
+    result.negative_ = !negative_ && !is_zero();
+    return result;
+  }
+
+  BigInteger &operator+=(const BigInteger &other) {
+    if (negative_ == other.negative_) {
+      magnitude_ = add_magnitudes(magnitude_, other.magnitude_);
+    } else if (compare_magnitudes(magnitude_, other.magnitude_) >= 0) {
+      magnitude_ = subtract_magnitudes(magnitude_, other.magnitude_);
+    } else {
+      magnitude_ = subtract_magnitudes(other.magnitude_, magnitude_);
+      negative_ = other.negative_;
+    }
+    normalize();
+    return *this;
+  }
+
+  BigInteger &operator-=(const BigInteger &other) {
+    return *this += -other;
+  }
+
+  BigInteger &operator*=(const BigInteger &other) {
+    magnitude_ = multiply_magnitudes(magnitude_, other.magnitude_);
+    negative_ = negative_ != other.negative_;
+    normalize();
+    return *this;
+  }
+
+  // Деление с отбрасыванием дробной части, как у встроенных целых; делитель не ноль
+  BigInteger &operator/=(const BigInteger &other) {
+    Limbs quotient, remainder;
+    divide_magnitudes(magnitude_, other.magnitude_, quotient, remainder);
+    magnitude_ = std::move(quotient);
+    negative_ = negative_ != other.negative_;
+    normalize();
+    return *this;
+  }
+
+  // Знак остатка совпадает со знаком делимого
+  BigInteger &operator%=(const BigInteger &other) {
+    Limbs quotient, remainder;
+    divide_magnitudes(magnitude_, other.magnitude_, quotient, remainder);
+    magnitude_ = std::move(remainder);
+    normalize();
+    return *this;
+  }
+
+  friend BigInteger operator+(BigInteger lhs, const BigInteger &rhs) {
+    return lhs += rhs;
+  }
+
+  friend BigInteger operator-(BigInteger lhs, const BigInteger &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend BigInteger operator*(BigInteger lhs, const BigInteger &rhs) {
+    return lhs *= rhs;
+  }
+
+  friend BigInteger operator/(BigInteger lhs, const BigInteger &rhs) {
+    return lhs /= rhs;
+  }
+
+  friend BigInteger operator%(BigInteger lhs, const BigInteger &rhs) {
+    return lhs %= rhs;
+  }
+
+  friend bool operator==(const BigInteger &lhs, const BigInteger &rhs) {
+    return lhs.negative_ == rhs.negative_ && lhs.magnitude_ == rhs.magnitude_;
+  }
+
+  friend bool operator!=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator<(const BigInteger &lhs, const BigInteger &rhs) {
+    if (lhs.negative_ != rhs.negative_) {
+      return lhs.negative_;
+    }
+    int comparison = compare_magnitudes(lhs.magnitude_, rhs.magnitude_);
+    return lhs.negative_ ? comparison > 0 : comparison < 0;
+  }
+
+  friend bool operator>(const BigInteger &lhs, const BigInteger &rhs) {
+    return rhs < lhs;
+  }
+
+  friend bool operator<=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(rhs < lhs);
+  }
+
+  friend bool operator>=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs < rhs);
+  }
+
+  friend BigInteger abs(BigInteger value) {
+    value.negative_ = false;
+    return value;
+  }
+
+  friend BigInteger gcd(BigInteger lhs, BigInteger rhs) {
+    lhs = abs(std::move(lhs));
+    rhs = abs(std::move(rhs));
+    while (!rhs.is_zero()) {
+      lhs %= rhs;
+      std::swap(lhs, rhs);
+    }
+    return lhs;
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const BigInteger &value) {
+    if (value.is_zero()) {
+      return out << 0;
+    }
+    // Разряды по основанию 10^9, младшие первыми
+    std::vector<uint32_t> digits;
+    Limbs rest = value.magnitude_;
+    while (!rest.empty()) {
+      Limbs quotient, remainder;
+      divide_magnitudes(rest, {1000000000u}, quotient, remainder);
+      digits.push_back(remainder.empty() ? 0 : remainder[0]);
+      rest = std::move(quotient);
+    }
+    if (value.negative_) {
+      out << '-';
+    }
+    out << digits.back();
+    char fill = out.fill('0');
+    for (size_t i = digits.size() - 1; i-- > 0;) {
+      out << std::setw(9) << digits[i];
+    }
+    out.fill(fill);
+    return out;
+  }
+
+ private:
+  using Limbs = std::vector<uint32_t>;
+
+  bool negative_ = false;
+  Limbs magnitude_;
+
+  static void trim(Limbs &limbs) {
+    while (!limbs.empty() && limbs.back() == 0) {
+      limbs.pop_back();
+    }
+  }
+
+  // У нуля нет знака
+  void normalize() {
+    trim(magnitude_);
+    if (magnitude_.empty()) {
+      negative_ = false;
+    }
+  }
+
+  static int compare_magnitudes(const Limbs &lhs, const Limbs &rhs) {
+    if (lhs.size() != rhs.size()) {
+      return lhs.size() < rhs.size() ? -1 : 1;
+    }
+    for (size_t i = lhs.size(); i-- > 0;) {
+      if (lhs[i] != rhs[i]) {
+        return lhs[i] < rhs[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  static Limbs add_magnitudes(const Limbs &lhs, const Limbs &rhs) {
+    const Limbs &longer = lhs.size() >= rhs.size() ? lhs : rhs;
+    const Limbs &shorter = lhs.size() >= rhs.size() ? rhs : lhs;
+    Limbs result(longer.size() + 1);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < longer.size(); i++) {
+      carry += static_cast<uint64_t>(longer[i]) + (i < shorter.size() ? shorter[i] : 0);
+      result[i] = static_cast<uint32_t>(carry);
+      carry >>= 32;
+    }
+    result.back() = static_cast<uint32_t>(carry);
+    trim(result);
+    return result;
+  }
+
+  // |lhs| >= |rhs|
+  static Limbs subtract_magnitudes(const Limbs &lhs, const Limbs &rhs) {
+    Limbs result(lhs.size());
+    int64_t borrow = 0;
+    for (size_t i = 0; i < lhs.size(); i++) {
+      int64_t difference = static_cast<int64_t>(lhs[i]) - (i < rhs.size() ? rhs[i] : 0) - borrow;
+      borrow = difference < 0;
+      result[i] = static_cast<uint32_t>(difference);
+    }
+    trim(result);
+    return result;
+  }
+
+  static Limbs multiply_magnitudes(const Limbs &lhs, const Limbs &rhs) {
+    if (lhs.empty() || rhs.empty()) {
+      return {};
+    }
+    Limbs result(lhs.size() + rhs.size());
+    for (size_t i = 0; i < lhs.size(); i++) {
+      uint64_t carry = 0;
+      for (size_t j = 0; j < rhs.size(); j++) {
+        uint64_t current = static_cast<uint64_t>(lhs[i]) * rhs[j] + result[i + j] + carry;
+        result[i + j] = static_cast<uint32_t>(current);
+        carry = current >> 32;
+      }
+      result[i + rhs.size()] = static_cast<uint32_t>(carry);
+    }
+    trim(result);
+    return result;
+  }
+
+  // Алгоритм D Кнута. После сдвига, при котором у старшего разряда делителя стоит старший бит,
+  // цифра частного по двум старшим разрядам ошибается не больше чем на 2, и уточняется по третьему
+  static void divide_magnitudes(const Limbs &dividend, const Limbs &divisor, Limbs &quotient, Limbs &remainder) {
+    if (compare_magnitudes(dividend, divisor) < 0) {
+      quotient.clear();
+      remainder = dividend;
+      return;
+    }
+    if (divisor.size() == 1) {
+      quotient.assign(dividend.size(), 0);
+      uint64_t rest = 0;
+      for (size_t i = dividend.size(); i-- > 0;) {
+        uint64_t current = (rest << 32) | dividend[i];
+        quotient[i] = static_cast<uint32_t>(current / divisor[0]);
+        rest = current % divisor[0];
+      }
+      trim(quotient);
+      remainder.assign(rest == 0 ? 0 : 1, static_cast<uint32_t>(rest));
+      return;
+    }
+
+    int shift = __builtin_clz(divisor.back());
+    auto shifted = [shift](const Limbs &limbs, size_t size) {
+      Limbs result(size, 0);
+      for (size_t i = 0; i < limbs.size(); i++) {
+        result[i] |= limbs[i] << shift;
+        if (shift != 0 && i + 1 < size) {
+          result[i + 1] |= limbs[i] >> (32 - shift);
+        }
+      }
+      return result;
+    };
+    size_t n = divisor.size();
+    size_t m = dividend.size() - n;
+    Limbs u = shifted(dividend, dividend.size() + 1);
+    Limbs v = shifted(divisor, n);
+
+    quotient.assign(m + 1, 0);
+    for (size_t j = m + 1; j-- > 0;) {
+      uint64_t numerator = (static_cast<uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+      uint64_t digit = numerator / v[n - 1];
+      uint64_t rest = numerator % v[n - 1];
+      while ((digit >> 32) != 0 || digit * v[n - 2] > ((rest << 32) | u[j + n - 2])) {
+        digit--;
+        rest += v[n - 1];
+        if ((rest >> 32) != 0) {
+          break;
+        }
+      }
+
+      // u[j, j + n] -= digit * v
+      uint64_t carry = 0;
+      int64_t borrow = 0;
+      for (size_t i = 0; i < n; i++) {
+        uint64_t product = digit * v[i] + carry;
+        carry = product >> 32;
+        int64_t difference = static_cast<int64_t>(u[i + j]) - static_cast<int64_t>(product & 0xffffffffu) - borrow;
+        borrow = difference < 0;
+        u[i + j] = static_cast<uint32_t>(difference);
+      }
+      int64_t difference = static_cast<int64_t>(u[j + n]) - static_cast<int64_t>(carry) - borrow;
+      u[j + n] = static_cast<uint32_t>(difference);
+
+      // Цифра оказалась на единицу больше: возвращаем делитель обратно
+      if (difference < 0) {
+        digit--;
+        uint64_t sum_carry = 0;
+        for (size_t i = 0; i < n; i++) {
+          uint64_t sum = static_cast<uint64_t>(u[i + j]) + v[i] + sum_carry;
+          u[i + j] = static_cast<uint32_t>(sum);
+          sum_carry = sum >> 32;
+        }
+        u[j + n] += static_cast<uint32_t>(sum_carry);
+      }
+      quotient[j] = static_cast<uint32_t>(digit);
+    }
+    trim(quotient);
+
+    remainder.assign(n, 0);
+    for (size_t i = 0; i < n; i++) {
+      remainder[i] = u[i] >> shift;
+      if (shift != 0) {
+        remainder[i] |= u[i + 1] << (32 - shift);
+      }
+    }
+    trim(remainder);
+  }
+};
+
+#endif //LINEARALG_BIGINTEGER_H
@@ -0,0 +1,399 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_BITMATRIX_H
+#define LINEARALG_BITMATRIX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "Matrix.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+
+// Метод четырёх русских: таблица на BIT_TABLE_BITS строк хранит все 2^BIT_TABLE_BITS их сумм,
+// и за один проход по строке применяются BIT_TABLE_COUNT таблиц
+constexpr size_t BIT_TABLE_BITS = 8;
+constexpr size_t BIT_TABLE_COUNT = 4;
+// Ширина полосы столбцов произведения в словах: таблицы для неё помещаются в L2
+constexpr size_t BIT_MULTIPLY_WORDS = 32;
+
+// Матрица над GF(2): строка упакована в 64-битные слова, столбец j - бит j % 64 слова j / 64.
+// Сложение строк - XOR целыми словами, так что одна операция обрабатывает 64 столбца, а память
+// в 64 раза меньше, чем у Matrix<char>. Биты за последним столбцом строки всегда нулевые.
+class BitMatrix {
+ public:
+  using word_type = uint64_t;
+  static constexpr size_t WORD_BITS = 64;
+
+  BitMatrix() {
+
+  }
+
+  BitMatrix(size_t horizontal_size, size_t vertical_size)
+          : data_((horizontal_size + WORD_BITS - 1) / WORD_BITS * vertical_size, 0),
+            vertical_size_(vertical_size),
+            horizontal_size_(horizontal_size),
+            stride_((horizontal_size + WORD_BITS - 1) / WORD_BITS) {
+  }
+
+  // Нечётные элементы становятся единицами, чётные - нулями
+  explicit BitMatrix(const Matrix<int> &matrix)
+          : BitMatrix(matrix.horizontal_size(), matrix.vertical_size()) {
+    for (size_t i = 0; i < vertical_size_; i++) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        set(i, j, matrix[i][j] % 2 != 0);
+      }
+    }
+  }
+
+  static BitMatrix identity(size_t size) {
+    BitMatrix result(size, size);
+    for (size_t i = 0; i < size; i++) {
+      result.set(i, i, true);
+    }
+    return result;
+  }
+
+  size_t vertical_size() const {
+    return vertical_size_;
+  }
+
+  size_t horizontal_size() const {
+    return horizontal_size_;
+  }
+
+  std::pair<size_t, size_t> size() const {
+    return {vertical_size(), horizontal_size()};
+  }
+
+  bool empty() const {
+    return vertical_size_ == 0 || horizontal_size_ == 0;
+  }
+
+  // Число слов в строке
+  size_t stride() const {
+    return stride_;
+  }
+
+  word_type *operator[](size_t position) {
+    return data_.data() + position * stride_;
+  }
+
+  const word_type *operator[](size_t position) const {
+    return data_.data() + position * stride_;
+  }
+
+  bool operator()(size_t i, size_t j) const {
+    return ((*this)[i][j / WORD_BITS] >> (j % WORD_BITS)) & 1;
+  }
+
+  void set(size_t i, size_t j, bool value) {
+    word_type bit = word_type(1) << (j % WORD_BITS);
+    if (value) {
+      (*this)[i][j / WORD_BITS] |= bit;
+    } else {
+      (*this)[i][j / WORD_BITS] &= ~bit;
+    }
+  }
+
+  // Строка target += строка source
+  void xor_lines(size_t source, size_t target) {
+    vector_xor(stride_, (*this)[source], (*this)[target]);
+  }
+
+  void swap_lines(size_t first, size_t second) {
+    if (first != second) {
+      std::swap_ranges((*this)[first], (*this)[first] + stride_, (*this)[second]);
+    }
+  }
+
+  Matrix<int> dense() const {
+    Matrix<int> result(horizontal_size_, vertical_size_);
+    for (size_t i = 0; i < vertical_size_; i++) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        result[i][j] = (*this)(i, j);
+      }
+    }
+    return result;
+  }
+
+  bool operator==(const BitMatrix &other) const {
+    return size() == other.size() && data_ == other.data_;
+  }
+
+  bool operator!=(const BitMatrix &other) const {
+    return !(*this == other);
+  }
+
+  BitMatrix &operator+=(const BitMatrix &other) {
+    vector_xor(data_.size(), other.data_.data(), data_.data());
+    return *this;
+  }
+
+  friend BitMatrix operator+(BitMatrix lhs, const BitMatrix &rhs) {
+    lhs += rhs;
+    return lhs;
+  }
+
+  // Умножение методом четырёх русских (M4RM): строки other по BIT_TABLE_BITS собираются в таблицы всех
+  // сумм, и каждые BIT_TABLE_BITS бит строки *this заменяются одним XOR строки таблицы. Это O(n^3 / log n)
+  // операций над словами вместо O(n^3); столбцы результата обрабатываются полосами, чтобы таблицы были в кэше,
+  // а строки каждой полосы делятся между потоками
+  BitMatrix operator*(const BitMatrix &other) const {
+    BitMatrix result(other.horizontal_size_, vertical_size_);
+    size_t depth = horizontal_size_;
+    size_t strip_bits = BIT_TABLE_BITS * BIT_TABLE_COUNT;
+    std::vector<word_type> tables;
+    for (size_t first_word = 0; first_word < other.stride_; first_word += BIT_MULTIPLY_WORDS) {
+      size_t width = std::min(BIT_MULTIPLY_WORDS, other.stride_ - first_word);
+      for (size_t strip = 0; strip < depth; strip += strip_bits) {
+        size_t count = std::min(BIT_TABLE_COUNT, (depth - strip + BIT_TABLE_BITS - 1) / BIT_TABLE_BITS);
+        tables.assign((count << BIT_TABLE_BITS) * width, 0);
+        for (size_t t = 0; t < count; t++) {
+          size_t base = strip + t * BIT_TABLE_BITS;
+          build_table(tables.data() + (t << BIT_TABLE_BITS) * width, width, std::min(BIT_TABLE_BITS, depth - base),
+                      [&](size_t bit) {
+                        return other[base + bit] + first_word;
+                      });
+        }
+        // strip кратен 32, поэтому биты полосы лежат в одном слове строки
+        auto multiply_lines = [&](size_t first, size_t last) {
+          for (size_t i = first; i < last; i++) {
+            word_type bits = (*this)[i][strip / WORD_BITS] >> (strip % WORD_BITS);
+            word_type *target = result[i] + first_word;
+            for (size_t t = 0; t < count; t++) {
+              size_t mask = (bits >> (t * BIT_TABLE_BITS)) & ((1u << BIT_TABLE_BITS) - 1);
+              if (mask != 0) {
+                vector_xor(width, tables.data() + ((t << BIT_TABLE_BITS) + mask) * width, target);
+              }
+            }
+          }
+        };
+        if (vertical_size_ * width >= 1 << 14) {
+          parallel_for(0, vertical_size_, 64, multiply_lines);
+        } else {
+          multiply_lines(0, vertical_size_);
+        }
+      }
+    }
+    return result;
+  }
+
+  std::vector<bool> operator*(const std::vector<bool> &vector) const {
+    std::vector<word_type> packed = pack(vector);
+    std::vector<bool> result(vertical_size_);
+    for (size_t i = 0; i < vertical_size_; i++) {
+      const word_type *line = (*this)[i];
+      word_type parity = 0;
+      for (size_t w = 0; w < stride_; w++) {
+        parity ^= line[w] & packed[w];
+      }
+      result[i] = __builtin_popcountll(parity) & 1;
+    }
+    return result;
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const BitMatrix &matrix) {
+    return out << matrix.dense();
+  }
+
+  // Ступенчатый вид: ведущий элемент строки i стоит в столбце pivots[i], ниже ведущих элементов нули.
+  // Исключение заканчивается, как только кончаются строки. Возвращает столбцы ведущих элементов
+  std::vector<size_t> make_row_echelon() {
+    return eliminate(false);
+  }
+
+  // Улучшенный ступенчатый вид: нули и выше ведущих элементов
+  BitMatrix &make_gauss() {
+    eliminate(true);
+    return *this;
+  }
+
+  BitMatrix row_echelon() const {
+    BitMatrix copy = *this;
+    copy.make_row_echelon();
+    return copy;
+  }
+
+  BitMatrix gauss() const {
+    BitMatrix copy = *this;
+    copy.make_gauss();
+    return copy;
+  }
+
+  std::vector<size_t> pivot_columns() const {
+    return BitMatrix(*this).make_row_echelon();
+  }
+
+  size_t rank() const {
+    return pivot_columns().size();
+  }
+
+  // Какое-нибудь решение A x = b (свободные переменные равны нулю) или пустой вектор, если решений нет
+  std::vector<bool> solve(const std::vector<bool> &b) const {
+    BitMatrix augmented(horizontal_size_ + 1, vertical_size_);
+    for (size_t i = 0; i < vertical_size_; i++) {
+      std::copy((*this)[i], (*this)[i] + stride_, augmented[i]);
+      augmented.set(i, horizontal_size_, b[i]);
+    }
+    std::vector<size_t> pivots = augmented.eliminate(true);
+    if (!pivots.empty() && pivots.back() == horizontal_size_) {
+      return {};
+    }
+    std::vector<bool> result(horizontal_size_, false);
+    for (size_t i = 0; i < pivots.size(); i++) {
+      result[pivots[i]] = augmented(i, horizontal_size_);
+    }
+    return result;
+  }
+
+  // Приведением [A | E] к улучшенному ступенчатому виду. Вырожденная матрица становится пустой
+  BitMatrix &inverse() {
+    size_t n = vertical_size_;
+    if (n != horizontal_size_) {
+      *this = BitMatrix();
+      return *this;
+    }
+    BitMatrix augmented(2 * n, n);
+    for (size_t i = 0; i < n; i++) {
+      std::copy((*this)[i], (*this)[i] + stride_, augmented[i]);
+      augmented.set(i, n + i, true);
+    }
+    std::vector<size_t> pivots = augmented.eliminate(true);
+    if (pivots.size() != n || (n != 0 && pivots.back() != n - 1)) {
+      *this = BitMatrix();
+      return *this;
+    }
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        set(i, j, augmented(i, n + j));
+      }
+    }
+    return *this;
+  }
+
+  BitMatrix inversed() const {
+    BitMatrix result = *this;
+    result.inverse();
+    return result;
+  }
+
+ private:
+  std::vector<word_type> data_;
+  size_t vertical_size_ = 0;
+  size_t horizontal_size_ = 0;
+  size_t stride_ = 0;
+
+  std::vector<word_type> pack(const std::vector<bool> &vector) const {
+    std::vector<word_type> packed(stride_, 0);
+    for (size_t j = 0; j < horizontal_size_; j++) {
+      if (vector[j]) {
+        packed[j / WORD_BITS] |= word_type(1) << (j % WORD_BITS);
+      }
+    }
+    return packed;
+  }
+
+  // table[x] = сумма строк line(b) по единичным битам b числа x, x < 2^bits. Каждая запись - одна
+  // предыдущая запись плюс одна строка
+  template<typename Line>
+  static void build_table(word_type *table, size_t width, size_t bits, const Line &line) {
+    for (size_t x = 1; x < (size_t(1) << bits); x++) {
+      word_type *entry = table + x * width;
+      std::copy(table + (x & (x - 1)) * width, table + (x & (x - 1)) * width + width, entry);
+      vector_xor(width, line(__builtin_ctzll(x)), entry);
+    }
+  }
+
+  // Метод четырёх русских для исключения (M4RI): столбцы обрабатываются полосами по
+  // BIT_TABLE_BITS * BIT_TABLE_COUNT. В полосе обычным исключением ищутся ведущие строки, приведённые
+  // друг по другу, из них строятся таблицы сумм, и все остальные строки очищаются от полосы
+  // несколькими XOR строк таблиц вместо XOR на каждый ведущий столбец
+  std::vector<size_t> eliminate(bool reduced) {
+    std::vector<size_t> pivots;
+    std::vector<word_type> tables;
+    size_t row = 0;
+    for (size_t column = 0; row < vertical_size_ && column < horizontal_size_;) {
+      size_t block_end = std::min(horizontal_size_, column + BIT_TABLE_BITS * BIT_TABLE_COUNT);
+      // Строки от row и ниже нулевые левее column, поэтому всё начинается со слова column / 64
+      size_t first_word = column / WORD_BITS;
+      size_t width = stride_ - first_word;
+      size_t first_pivot = pivots.size();
+      auto pivot_line = [&](size_t p) {
+        return (*this)[row + p - first_pivot] + first_word;
+      };
+
+      for (size_t j = column; j < block_end && row + pivots.size() - first_pivot < vertical_size_; j++) {
+        size_t top = row + pivots.size() - first_pivot;
+        for (size_t i = top; i < vertical_size_; i++) {
+          // Строка приводится по ведущим строкам полосы только когда до неё доходит поиск
+          for (size_t p = first_pivot; p < pivots.size(); p++) {
+            if ((*this)(i, pivots[p])) {
+              vector_xor(width, pivot_line(p), (*this)[i] + first_word);
+            }
+          }
+          if ((*this)(i, j)) {
+            swap_lines(i, top);
+            for (size_t p = first_pivot; p < pivots.size(); p++) {
+              if ((*this)(row + p - first_pivot, j)) {
+                vector_xor(width, (*this)[top] + first_word, pivot_line(p));
+              }
+            }
+            pivots.push_back(j);
+            break;
+          }
+        }
+      }
+      size_t found = pivots.size() - first_pivot;
+      if (found == 0) {
+        column = block_end;
+        continue;
+      }
+
+      // Ведущие строки полосы единичны на её ведущих столбцах, так что строка очищается суммой
+      // тех из них, чьи ведущие столбцы в ней единичны
+      size_t count = (found + BIT_TABLE_BITS - 1) / BIT_TABLE_BITS;
+      tables.assign((count << BIT_TABLE_BITS) * width, 0);
+      for (size_t t = 0; t < count; t++) {
+        size_t base = first_pivot + t * BIT_TABLE_BITS;
+        build_table(tables.data() + (t << BIT_TABLE_BITS) * width, width, std::min(BIT_TABLE_BITS, found - t * BIT_TABLE_BITS),
+                    [&](size_t bit) {
+                      return pivot_line(base + bit);
+                    });
+      }
+      auto eliminate_lines = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+          if (i >= row && i < row + found) {
+            continue;
+          }
+          word_type *line = (*this)[i] + first_word;
+          for (size_t t = 0; t < count; t++) {
+            size_t base = first_pivot + t * BIT_TABLE_BITS;
+            size_t bits = std::min(BIT_TABLE_BITS, found - t * BIT_TABLE_BITS);
+            size_t mask = 0;
+            for (size_t b = 0; b < bits; b++) {
+              mask |= size_t((*this)(i, pivots[base + b])) << b;
+            }
+            if (mask != 0) {
+              vector_xor(width, tables.data() + ((t << BIT_TABLE_BITS) + mask) * width, line);
+            }
+          }
+        }
+      };
+      size_t first_line = reduced ? 0 : row + found;
+      if ((vertical_size_ - first_line) * width >= 1 << 14) {
+        parallel_for(first_line, vertical_size_, 64, eliminate_lines);
+      } else {
+        eliminate_lines(first_line, vertical_size_);
+      }
+      row += found;
+      column = block_end;
+    }
+    return pivots;
+  }
+};
+
+#endif //LINEARALG_BITMATRIX_H
@@ -0,0 +1,635 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_FIXEDMATRIX_H
+#define LINEARALG_FIXEDMATRIX_H
+
+#include <array>
+#include <initializer_list>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "Matrix.h"
+
+// Определитель по явной формуле для N <= 4; get(i, j) возвращает элемент.
+// Та же формула используется и для одной матрицы, и для пачки в SoA, где get читает одну дорожку
+template<typename T, size_t N, typename Get>
+constexpr T fixed_determinant(const Get &get) {
+  static_assert(N <= 4, "closed form is used only up to 4 x 4");
+  if constexpr (N == 0) {
+    return T(1);
+  } else if constexpr (N == 1) {
+    return get(0, 0);
+  } else if constexpr (N == 2) {
+    return get(0, 0) * get(1, 1) - get(0, 1) * get(1, 0);
+  } else if constexpr (N == 3) {
+    return get(0, 0) * (get(1, 1) * get(2, 2) - get(1, 2) * get(2, 1))
+           - get(0, 1) * (get(1, 0) * get(2, 2) - get(1, 2) * get(2, 0))
+           + get(0, 2) * (get(1, 0) * get(2, 1) - get(1, 1) * get(2, 0));
+  } else {
+    // Разложение Лапласа по двум верхним и двум нижним строкам
+    T s0 = get(0, 0) * get(1, 1) - get(1, 0) * get(0, 1);
+    T s1 = get(0, 0) * get(1, 2) - get(1, 0) * get(0, 2);
+    T s2 = get(0, 0) * get(1, 3) - get(1, 0) * get(0, 3);
+    T s3 = get(0, 1) * get(1, 2) - get(1, 1) * get(0, 2);
+    T s4 = get(0, 1) * get(1, 3) - get(1, 1) * get(0, 3);
+    T s5 = get(0, 2) * get(1, 3) - get(1, 2) * get(0, 3);
+    T c0 = get(2, 0) * get(3, 1) - get(3, 0) * get(2, 1);
+    T c1 = get(2, 0) * get(3, 2) - get(3, 0) * get(2, 2);
+    T c2 = get(2, 0) * get(3, 3) - get(3, 0) * get(2, 3);
+    T c3 = get(2, 1) * get(3, 2) - get(3, 1) * get(2, 2);
+    T c4 = get(2, 1) * get(3, 3) - get(3, 1) * get(2, 3);
+    T c5 = get(2, 2) * get(3, 3) - get(3, 2) * get(2, 3);
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+}
+
+// Присоединённая матрица для N <= 4: set(i, j, value) записывает её элемент (i, j)
+template<typename T, size_t N, typename Get, typename Set>
+constexpr void fixed_adjugate(const Get &get, const Set &set) {
+  static_assert(N <= 4, "closed form is used only up to 4 x 4");
+  if constexpr (N == 1) {
+    set(0, 0, T(1));
+  } else if constexpr (N == 2) {
+    set(0, 0, get(1, 1));
+    set(0, 1, -get(0, 1));
+    set(1, 0, -get(1, 0));
+    set(1, 1, get(0, 0));
+  } else if constexpr (N == 3) {
+    // Циклический сдвиг индексов сам даёт знак алгебраического дополнения
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        set(j, i, get((i + 1) % 3, (j + 1) % 3) * get((i + 2) % 3, (j + 2) % 3)
+                  - get((i + 1) % 3, (j + 2) % 3) * get((i + 2) % 3, (j + 1) % 3));
+      }
+    }
+  } else if constexpr (N == 4) {
+    T s0 = get(0, 0) * get(1, 1) - get(1, 0) * get(0, 1);
+    T s1 = get(0, 0) * get(1, 2) - get(1, 0) * get(0, 2);
+    T s2 = get(0, 0) * get(1, 3) - get(1, 0) * get(0, 3);
+    T s3 = get(0, 1) * get(1, 2) - get(1, 1) * get(0, 2);
+    T s4 = get(0, 1) * get(1, 3) - get(1, 1) * get(0, 3);
+    T s5 = get(0, 2) * get(1, 3) - get(1, 2) * get(0, 3);
+    T c0 = get(2, 0) * get(3, 1) - get(3, 0) * get(2, 1);
+    T c1 = get(2, 0) * get(3, 2) - get(3, 0) * get(2, 2);
+    T c2 = get(2, 0) * get(3, 3) - get(3, 0) * get(2, 3);
+    T c3 = get(2, 1) * get(3, 2) - get(3, 1) * get(2, 2);
+    T c4 = get(2, 1) * get(3, 3) - get(3, 1) * get(2, 3);
+    T c5 = get(2, 2) * get(3, 3) - get(3, 2) * get(2, 3);
+    set(0, 0, get(1, 1) * c5 - get(1, 2) * c4 + get(1, 3) * c3);
+    set(0, 1, -get(0, 1) * c5 + get(0, 2) * c4 - get(0, 3) * c3);
+    set(0, 2, get(3, 1) * s5 - get(3, 2) * s4 + get(3, 3) * s3);
+    set(0, 3, -get(2, 1) * s5 + get(2, 2) * s4 - get(2, 3) * s3);
+    set(1, 0, -get(1, 0) * c5 + get(1, 2) * c2 - get(1, 3) * c1);
+    set(1, 1, get(0, 0) * c5 - get(0, 2) * c2 + get(0, 3) * c1);
+    set(1, 2, -get(3, 0) * s5 + get(3, 2) * s2 - get(3, 3) * s1);
+    set(1, 3, get(2, 0) * s5 - get(2, 2) * s2 + get(2, 3) * s1);
+    set(2, 0, get(1, 0) * c4 - get(1, 1) * c2 + get(1, 3) * c0);
+    set(2, 1, -get(0, 0) * c4 + get(0, 1) * c2 - get(0, 3) * c0);
+    set(2, 2, get(3, 0) * s4 - get(3, 1) * s2 + get(3, 3) * s0);
+    set(2, 3, -get(2, 0) * s4 + get(2, 1) * s2 - get(2, 3) * s0);
+    set(3, 0, -get(1, 0) * c3 + get(1, 1) * c1 - get(1, 2) * c0);
+    set(3, 1, get(0, 0) * c3 - get(0, 1) * c1 + get(0, 2) * c0);
+    set(3, 2, -get(3, 0) * s3 + get(3, 1) * s1 - get(3, 2) * s0);
+    set(3, 3, get(2, 0) * s3 - get(2, 1) * s1 + get(2, 2) * s0);
+  }
+}
+
+// Матрица R x C с размерами в параметрах шаблона: элементы лежат прямо в объекте, без кучи и проверок
+// размеров во время выполнения. Интерфейс повторяет Matrix, так что обобщённый код работает с обеими,
+// а все операции constexpr, и циклы с известными границами компилятор разворачивает целиком.
+template<typename T, size_t R, size_t C>
+class FixedMatrix {
+ public:
+  using value_type = T;
+
+  constexpr FixedMatrix() : data_() {
+
+  }
+
+  constexpr FixedMatrix(std::initializer_list<std::initializer_list<T>> data) : data_() {
+    size_t i = 0;
+    for (auto line : data) {
+      size_t j = 0;
+      for (const T &value : line) {
+        data_[i * C + j++] = value;
+      }
+      i++;
+    }
+  }
+
+  explicit FixedMatrix(const Matrix<T> &matrix) : data_() {
+    for (size_t i = 0; i < R; i++) {
+      std::copy(matrix[i], matrix[i] + C, (*this)[i]);
+    }
+  }
+
+  explicit operator Matrix<T>() const {
+    Matrix<T> result(C, R);
+    result.view() = view();
+    return result;
+  }
+
+  static constexpr size_t vertical_size() {
+    return R;
+  }
+
+  static constexpr size_t horizontal_size() {
+    return C;
+  }
+
+  static constexpr size_t stride() {
+    return C;
+  }
+
+  static constexpr std::pair<size_t, size_t> size() {
+    return {R, C};
+  }
+
+  static constexpr bool empty() {
+    return R == 0 || C == 0;
+  }
+
+  constexpr T *data() {
+    return data_.data();
+  }
+
+  constexpr const T *data() const {
+    return data_.data();
+  }
+
+  constexpr T *operator[](size_t position) {
+    return data_.data() + position * C;
+  }
+
+  constexpr const T *operator[](size_t position) const {
+    return data_.data() + position * C;
+  }
+
+  constexpr T &operator()(size_t i, size_t j) {
+    return data_[i * C + j];
+  }
+
+  constexpr const T &operator()(size_t i, size_t j) const {
+    return data_[i * C + j];
+  }
+
+  MatrixView<T> view() {
+    return MatrixView<T>(data(), R, C, C);
+  }
+
+  MatrixView<const T> view() const {
+    return MatrixView<const T>(data(), R, C, C);
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const FixedMatrix &matrix) {
+    return out << matrix.view();
+  }
+
+  constexpr FixedMatrix &operator+=(const FixedMatrix &other) {
+    for (size_t i = 0; i < R * C; i++) {
+      data_[i] += other.data_[i];
+    }
+    return *this;
+  }
+
+  constexpr FixedMatrix &operator-=(const FixedMatrix &other) {
+    for (size_t i = 0; i < R * C; i++) {
+      data_[i] -= other.data_[i];
+    }
+    return *this;
+  }
+
+  template<typename S, typename = std::enable_if_t<std::is_convertible<S, T>::value>>
+  constexpr FixedMatrix &operator*=(const S &scalar) {
+    for (size_t i = 0; i < R * C; i++) {
+      data_[i] *= scalar;
+    }
+    return *this;
+  }
+
+  constexpr FixedMatrix &operator*=(const FixedMatrix<T, C, C> &other) {
+    *this = *this * other;
+    return *this;
+  }
+
+  constexpr FixedMatrix operator+(const FixedMatrix &other) const {
+    FixedMatrix result = *this;
+    result += other;
+    return result;
+  }
+
+  constexpr FixedMatrix operator-(const FixedMatrix &other) const {
+    FixedMatrix result = *this;
+    result -= other;
+    return result;
+  }
+
+  constexpr FixedMatrix operator-() const {
+    FixedMatrix result;
+    for (size_t i = 0; i < R * C; i++) {
+      result.data_[i] = -data_[i];
+    }
+    return result;
+  }
+
+  template<typename S, typename = std::enable_if_t<std::is_convertible<S, T>::value>>
+  constexpr FixedMatrix operator*(const S &scalar) const {
+    FixedMatrix result = *this;
+    result *= scalar;
+    return result;
+  }
+
+  template<size_t K>
+  constexpr FixedMatrix<T, R, K> operator*(const FixedMatrix<T, C, K> &other) const {
+    FixedMatrix<T, R, K> result;
+    for (size_t i = 0; i < R; i++) {
+      for (size_t k = 0; k < C; k++) {
+        for (size_t j = 0; j < K; j++) {
+          result(i, j) += (*this)(i, k) * other(k, j);
+        }
+      }
+    }
+    return result;
+  }
+
+  constexpr bool operator==(const FixedMatrix &other) const {
+    for (size_t i = 0; i < R * C; i++) {
+      if (!(data_[i] == other.data_[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool operator!=(const FixedMatrix &other) const {
+    return !(*this == other);
+  }
+
+  constexpr FixedMatrix<T, C, R> transposed() const {
+    FixedMatrix<T, C, R> result;
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) {
+        result(j, i) = (*this)(i, j);
+      }
+    }
+    return result;
+  }
+
+  constexpr FixedMatrix &transpose() {
+    static_assert(R == C, "only a square matrix can be transposed in place");
+    *this = transposed();
+    return *this;
+  }
+
+  // До 4 x 4 - явная формула, дальше - исключение Гаусса (Барейса для целых и точных типов)
+  constexpr T determinant() const {
+    static_assert(R == C, "determinant of a non-square matrix");
+    if constexpr (R <= 4) {
+      return fixed_determinant<T, R>(*this);
+    } else if constexpr (std::is_floating_point<T>::value) {
+      FixedMatrix copy = *this;
+      T result = T(1);
+      for (size_t k = 0; k < R; k++) {
+        size_t pivot = copy.pivot_line(k);
+        if (copy(pivot, k) == T(0)) {
+          return T(0);
+        }
+        if (pivot != k) {
+          copy.swap_lines(pivot, k);
+          result = -result;
+        }
+        result *= copy(k, k);
+        for (size_t i = k + 1; i < R; i++) {
+          T coefficient = copy(i, k) / copy(k, k);
+          for (size_t j = k + 1; j < R; j++) {
+            copy(i, j) -= coefficient * copy(k, j);
+          }
+        }
+      }
+      return result;
+    } else {
+      FixedMatrix copy = *this;
+      T sign = T(1);
+      T previous_pivot = T(1);
+      for (size_t k = 0; k + 1 < R; k++) {
+        if (copy(k, k) == T(0)) {
+          size_t pivot = k + 1;
+          while (pivot < R && copy(pivot, k) == T(0)) {
+            pivot++;
+          }
+          if (pivot == R) {
+            return T(0);
+          }
+          copy.swap_lines(k, pivot);
+          sign = -sign;
+        }
+        for (size_t i = k + 1; i < R; i++) {
+          for (size_t j = k + 1; j < R; j++) {
+            copy(i, j) = (copy(i, j) * copy(k, k) - copy(i, k) * copy(k, j)) / previous_pivot;
+          }
+        }
+        previous_pivot = copy(k, k);
+      }
+      return sign * copy(R - 1, R - 1);
+    }
+  }
+
+  // Для вырожденной матрицы получается нулевая: пустой, как у Matrix, фиксированная быть не может
+  constexpr FixedMatrix &inverse() {
+    *this = inversed();
+    return *this;
+  }
+
+  constexpr FixedMatrix inversed() const {
+    static_assert(R == C, "inverse of a non-square matrix");
+    FixedMatrix result;
+    if constexpr (R <= 4) {
+      T determinant_value = determinant();
+      if (determinant_value == T(0)) {
+        return result;
+      }
+      fixed_adjugate<T, R>(*this, [&](size_t i, size_t j, const T &value) {
+        result(i, j) = value / determinant_value;
+      });
+    } else {
+      // Гаусс-Жордан с выбором главного элемента по столбцу
+      FixedMatrix copy = *this;
+      result = FixedMatrix::identity();
+      for (size_t k = 0; k < R; k++) {
+        size_t pivot = copy.pivot_line(k);
+        if (copy(pivot, k) == T(0)) {
+          return FixedMatrix();
+        }
+        copy.swap_lines(pivot, k);
+        result.swap_lines(pivot, k);
+        T coefficient = copy(k, k);
+        for (size_t j = 0; j < R; j++) {
+          copy(k, j) /= coefficient;
+          result(k, j) /= coefficient;
+        }
+        for (size_t i = 0; i < R; i++) {
+          if (i == k || copy(i, k) == T(0)) continue;
+          T factor = copy(i, k);
+          for (size_t j = 0; j < R; j++) {
+            copy(i, j) -= factor * copy(k, j);
+            result(i, j) -= factor * result(k, j);
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  static constexpr FixedMatrix identity() {
+    static_assert(R == C, "identity matrix is square");
+    FixedMatrix result;
+    for (size_t i = 0; i < R; i++) {
+      result(i, i) = T(1);
+    }
+    return result;
+  }
+
+ private:
+  std::array<T, R * C> data_;
+
+  constexpr size_t pivot_line(size_t column) const {
+    size_t pivot = column;
+    for (size_t i = column + 1; i < R; i++) {
+      if (my_abs((*this)(i, column)) > my_abs((*this)(pivot, column))) {
+        pivot = i;
+      }
+    }
+    return pivot;
+  }
+
+  constexpr void swap_lines(size_t first, size_t second) {
+    for (size_t j = 0; j < C && first != second; j++) {
+      T value = (*this)(first, j);
+      (*this)(first, j) = (*this)(second, j);
+      (*this)(second, j) = value;
+    }
+  }
+};
+
+template<typename T, size_t N>
+constexpr FixedMatrix<T, N, N> FixedIdentity() {
+  return FixedMatrix<T, N, N>::identity();
+}
+
+// Одно и то же число в LANES соседних матрицах пачки. Операции поэлементные, поэтому явные формулы
+// fixed_determinant и fixed_adjugate, вызванные с LanePack вместо T, считают сразу LANES матриц,
+// а каждый их шаг - короткий цикл без ветвлений, который компилятор переводит в векторные инструкции
+template<typename T, size_t LANES>
+struct LanePack {
+  T values[LANES];
+
+  // Без инициализации: все операции ниже целиком перезаписывают результат
+  LanePack() {
+
+  }
+
+  explicit LanePack(const T &value) {
+    for (size_t lane = 0; lane < LANES; lane++) {
+      values[lane] = value;
+    }
+  }
+
+  static LanePack load(const T *source) {
+    LanePack result;
+    std::copy(source, source + LANES, result.values);
+    return result;
+  }
+
+  void store(T *destination) const {
+    std::copy(values, values + LANES, destination);
+  }
+
+  friend LanePack operator+(const LanePack &lhs, const LanePack &rhs) {
+    LanePack result;
+    for (size_t lane = 0; lane < LANES; lane++) {
+      result.values[lane] = lhs.values[lane] + rhs.values[lane];
+    }
+    return result;
+  }
+
+  friend LanePack operator-(const LanePack &lhs, const LanePack &rhs) {
+    LanePack result;
+    for (size_t lane = 0; lane < LANES; lane++) {
+      result.values[lane] = lhs.values[lane] - rhs.values[lane];
+    }
+    return result;
+  }
+
+  friend LanePack operator*(const LanePack &lhs, const LanePack &rhs) {
+    LanePack result;
+    for (size_t lane = 0; lane < LANES; lane++) {
+      result.values[lane] = lhs.values[lane] * rhs.values[lane];
+    }
+    return result;
+  }
+
+  friend LanePack operator/(const LanePack &lhs, const LanePack &rhs) {
+    LanePack result;
+    for (size_t lane = 0; lane < LANES; lane++) {
+      result.values[lane] = lhs.values[lane] / rhs.values[lane];
+    }
+    return result;
+  }
+
+  LanePack operator-() const {
+    LanePack result;
+    for (size_t lane = 0; lane < LANES; lane++) {
+      result.values[lane] = -values[lane];
+    }
+    return result;
+  }
+};
+
+// Пачка матриц R x C в раскладке AoSoA: матрицы идут блоками по LANES, и внутри блока элемент (i, j)
+// всех его матриц лежит подряд, lanes(block, i, j)[lane]. Операция над пачкой обрабатывает блок целиком
+// через LanePack, а блок занимает один непрерывный участок памяти, так что чтение идёт потоком.
+// Число матриц дополняется до кратного LANES, лишние дорожки нулевые.
+template<typename T, size_t R, size_t C>
+class FixedMatrixBatch {
+ public:
+  static constexpr size_t LANES = 16;
+  using Pack = LanePack<T, LANES>;
+
+  FixedMatrixBatch() {
+
+  }
+
+  explicit FixedMatrixBatch(size_t count)
+          : count_(count), block_count_((count + LANES - 1) / LANES), data_(block_count_ * R * C * LANES) {
+  }
+
+  FixedMatrixBatch(const std::vector<FixedMatrix<T, R, C>> &matrices) : FixedMatrixBatch(matrices.size()) {
+    for (size_t index = 0; index < count_; index++) {
+      set(index, matrices[index]);
+    }
+  }
+
+  size_t size() const {
+    return count_;
+  }
+
+  size_t block_count() const {
+    return block_count_;
+  }
+
+  T *lanes(size_t block, size_t i, size_t j) {
+    return data_.data() + ((block * R + i) * C + j) * LANES;
+  }
+
+  const T *lanes(size_t block, size_t i, size_t j) const {
+    return data_.data() + ((block * R + i) * C + j) * LANES;
+  }
+
+  FixedMatrix<T, R, C> operator[](size_t index) const {
+    FixedMatrix<T, R, C> result;
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) {
+        result(i, j) = lanes(index / LANES, i, j)[index % LANES];
+      }
+    }
+    return result;
+  }
+
+  void set(size_t index, const FixedMatrix<T, R, C> &matrix) {
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) {
+        lanes(index / LANES, i, j)[index % LANES] = matrix(i, j);
+      }
+    }
+  }
+
+  template<size_t K>
+  FixedMatrixBatch<T, R, K> operator*(const FixedMatrixBatch<T, C, K> &other) const {
+    FixedMatrixBatch<T, R, K> result(count_);
+    for_each_block([&](size_t block) {
+      for (size_t i = 0; i < R; i++) {
+        for (size_t j = 0; j < K; j++) {
+          T accumulator[LANES] = {};
+          for (size_t k = 0; k < C; k++) {
+            const T *x = lanes(block, i, k);
+            const T *y = other.lanes(block, k, j);
+            for (size_t lane = 0; lane < LANES; lane++) {
+              accumulator[lane] += x[lane] * y[lane];
+            }
+          }
+          std::copy(accumulator, accumulator + LANES, result.lanes(block, i, j));
+        }
+      }
+    });
+    return result;
+  }
+
+  std::vector<T> determinants() const {
+    static_assert(R == C, "determinant of a non-square matrix");
+    std::vector<T> result(block_count_ * LANES);
+    for_each_block([&](size_t block) {
+      if constexpr (R <= 4) {
+        fixed_determinant<Pack, R>(block_reader(block)).store(result.data() + block * LANES);
+      } else {
+        for (size_t index = block * LANES; index < (block + 1) * LANES; index++) {
+          result[index] = (*this)[index].determinant();
+        }
+      }
+    });
+    result.resize(count_);
+    return result;
+  }
+
+  // Вырожденные матрицы, как и в FixedMatrix::inversed, становятся нулевыми. Присоединённая матрица делится
+  // на определитель, а не умножается на обратный к нему, чтобы результат совпадал с FixedMatrix::inversed
+  // и для целых, и в округлении
+  FixedMatrixBatch inversed() const {
+    static_assert(R == C, "inverse of a non-square matrix");
+    FixedMatrixBatch result(count_);
+    for_each_block([&](size_t block) {
+      if constexpr (R <= 4) {
+        Pack determinant_value = fixed_determinant<Pack, R>(block_reader(block));
+        // У вырожденных дорожек делитель заменяется единицей, а результат обнуляется маской
+        Pack divisor, mask;
+        for (size_t lane = 0; lane < LANES; lane++) {
+          bool singular = determinant_value.values[lane] == T(0);
+          divisor.values[lane] = singular ? T(1) : determinant_value.values[lane];
+          mask.values[lane] = singular ? T(0) : T(1);
+        }
+        fixed_adjugate<Pack, R>(block_reader(block), [&](size_t i, size_t j, const Pack &value) {
+          (value / divisor * mask).store(result.lanes(block, i, j));
+        });
+      } else {
+        for (size_t index = block * LANES; index < (block + 1) * LANES; index++) {
+          result.set(index, (*this)[index].inversed());
+        }
+      }
+    });
+    return result;
+  }
+
+ private:
+  size_t count_ = 0;
+  size_t block_count_ = 0;
+  std::vector<T> data_;
+
+  auto block_reader(size_t block) const {
+    return [this, block](size_t i, size_t j) {
+      return Pack::load(lanes(block, i, j));
+    };
+  }
+
+  // Блоки независимы и делятся между потоками
+  template<typename Function>
+  void for_each_block(const Function &function) const {
+    parallel_for(0, block_count_, 256, [&](size_t first, size_t last) {
+      for (size_t block = first; block < last; block++) {
+        function(block);
+      }
+    });
+  }
+};
+
+#endif //LINEARALG_FIXEDMATRIX_H
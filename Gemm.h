@@ -0,0 +1,213 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_GEMM_H
+#define LINEARALG_GEMM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Simd.h"
+#include "ThreadPool.h"
+
+// Размеры блоков для умножения: MR x NR - блок C, который микроядро держит в регистрах,
+// KC x NR - панель B в L1, MC x KC - панель A в L2, KC x NC - панель B в L3
+template<typename T>
+struct GemmBlocking {
+  static constexpr size_t MR = 4;
+  static constexpr size_t NR = 4;
+  static constexpr size_t MC = 128;
+  static constexpr size_t KC = 256;
+  static constexpr size_t NC = 4096;
+};
+
+template<>
+struct GemmBlocking<double> {
+  static constexpr size_t MR = 6;
+  static constexpr size_t NR = 8;
+  static constexpr size_t MC = 72;
+  static constexpr size_t KC = 256;
+  static constexpr size_t NC = 4080;
+};
+
+template<>
+struct GemmBlocking<float> {
+  static constexpr size_t MR = 6;
+  static constexpr size_t NR = 16;
+  static constexpr size_t MC = 144;
+  static constexpr size_t KC = 256;
+  static constexpr size_t NC = 4080;
+};
+
+// Для float и double есть перегрузки с векторными ядрами в Simd.h
+template<typename T>
+void gemm_kernel(size_t depth, const T *a, const T *b, T *c, size_t ldc) {
+  reference_gemm_kernel<T, GemmBlocking<T>::MR, GemmBlocking<T>::NR>(depth, a, b, c, ldc);
+}
+
+// Ядро для неполного блока на краю C: считаем в нулевой буфер и прибавляем нужную часть
+template<typename T, size_t MR, size_t NR>
+void gemm_edge_kernel(size_t depth, const T *a, const T *b, T *c, size_t ldc, size_t rows, size_t columns) {
+  T tile[MR * NR] = {};
+  gemm_kernel(depth, a, b, tile, NR);
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t j = 0; j < columns; j++) {
+      c[i * ldc + j] += tile[i * NR + j];
+    }
+  }
+}
+
+// Упаковывает блок A (rows x depth) в полосы по MR строк, недостающие строки заполняются нулями
+template<typename T, size_t MR>
+void gemm_pack_a(size_t rows, size_t depth, const T *a, size_t lda, T *packed) {
+  for (size_t i = 0; i < rows; i += MR) {
+    size_t height = std::min(MR, rows - i);
+    for (size_t p = 0; p < depth; p++) {
+      for (size_t r = 0; r < height; r++) {
+        packed[r] = a[(i + r) * lda + p];
+      }
+      for (size_t r = height; r < MR; r++) {
+        packed[r] = T(0);
+      }
+      packed += MR;
+    }
+  }
+}
+
+// Упаковывает блок B (depth x columns) в полосы по NR столбцов.
+// Если transposed, то в памяти построчно лежит B^T, то есть B(p, j) = b[j * ldb + p]
+template<typename T, size_t NR>
+void gemm_pack_b(size_t depth, size_t columns, const T *b, size_t ldb, bool transposed, T *packed) {
+  if (transposed) {
+    for (size_t j = 0; j < columns; j += NR) {
+      size_t width = std::min(NR, columns - j);
+      for (size_t p = 0; p < depth; p++) {
+        for (size_t r = 0; r < width; r++) {
+          packed[r] = b[(j + r) * ldb + p];
+        }
+        for (size_t r = width; r < NR; r++) {
+          packed[r] = T(0);
+        }
+        packed += NR;
+      }
+    }
+    return;
+  }
+  for (size_t j = 0; j < columns; j += NR) {
+    size_t width = std::min(NR, columns - j);
+    for (size_t p = 0; p < depth; p++) {
+      const T *b_row = b + p * ldb + j;
+      for (size_t r = 0; r < width; r++) {
+        packed[r] = b_row[r];
+      }
+      for (size_t r = width; r < NR; r++) {
+        packed[r] = T(0);
+      }
+      packed += NR;
+    }
+  }
+}
+
+// Буфер для упакованной панели A, у каждого потока свой
+template<typename T>
+std::vector<T> &gemm_buffer() {
+  thread_local std::vector<T> buffer;
+  return buffer;
+}
+
+// Буфер для упакованного блока B потока, вызвавшего gemm. Он только растёт, так что повторные
+// умножения тех же размеров не выделяют память
+template<typename T>
+T *gemm_packed_b(size_t size) {
+  thread_local std::vector<T> buffer;
+  if (buffer.size() < size) {
+    buffer.resize(size);
+  }
+  return buffer.data();
+}
+
+// C (m x n) += A (m x k) * B (k x n), все матрицы построчные с шагами lda, ldb, ldc.
+// Если transpose_b, то вместо B в памяти лежит B^T (n x k), и она не копируется.
+// Если subtract, то C -= A * B: знак меняется при упаковке B и ничего не стоит
+template<typename T>
+void gemm(size_t m, size_t n, size_t k,
+          const T *a, size_t lda,
+          const T *b, size_t ldb,
+          T *c, size_t ldc,
+          bool transpose_b = false,
+          bool subtract = false) {
+  using Blocking = GemmBlocking<T>;
+  constexpr size_t MR = Blocking::MR;
+  constexpr size_t NR = Blocking::NR;
+  constexpr size_t MC = Blocking::MC;
+  constexpr size_t KC = Blocking::KC;
+  constexpr size_t NC = Blocking::NC;
+
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+
+  T *packed_b = gemm_packed_b<T>(((std::min(NC, n) + NR - 1) / NR) * NR * std::min(KC, k));
+  // Мелкие умножения не стоит раздавать потокам
+  bool parallel = m * n * k >= 64 * 64 * 64;
+
+  for (size_t jc = 0; jc < n; jc += NC) {
+    size_t nc = std::min(NC, n - jc);
+    for (size_t pc = 0; pc < k; pc += KC) {
+      size_t kc = std::min(KC, k - pc);
+      const T *b_block = transpose_b ? b + jc * ldb + pc : b + pc * ldb + jc;
+
+      size_t b_panels = (nc + NR - 1) / NR;
+      auto pack_b_panels = [&](size_t first_panel, size_t last_panel) {
+        size_t width = std::min(nc, last_panel * NR) - first_panel * NR;
+        const T *b_panels = transpose_b ? b_block + first_panel * NR * ldb : b_block + first_panel * NR;
+        T *packed = packed_b + first_panel * NR * kc;
+        gemm_pack_b<T, NR>(kc, width, b_panels, ldb, transpose_b, packed);
+        if (subtract) {
+          size_t packed_size = (last_panel - first_panel) * NR * kc;
+          for (size_t i = 0; i < packed_size; i++) {
+            packed[i] = -packed[i];
+          }
+        }
+      };
+      if (parallel) {
+        parallel_for(0, b_panels, 16, pack_b_panels);
+      } else {
+        pack_b_panels(0, b_panels);
+      }
+
+      // Потоки делят между собой полосы C высоты MC, каждая полоса целиком считается одним потоком
+      size_t a_blocks = (m + MC - 1) / MC;
+      auto multiply_blocks = [&](size_t first_block, size_t last_block) {
+        std::vector<T> &packed_a = gemm_buffer<T>();
+        packed_a.resize(((std::min(MC, m) + MR - 1) / MR) * MR * kc);
+        for (size_t ic = first_block * MC; ic < std::min(m, last_block * MC); ic += MC) {
+          size_t mc = std::min(MC, m - ic);
+          gemm_pack_a<T, MR>(mc, kc, a + ic * lda + pc, lda, packed_a.data());
+
+          for (size_t jr = 0; jr < nc; jr += NR) {
+            const T *b_panel = packed_b + jr * kc;
+            for (size_t ir = 0; ir < mc; ir += MR) {
+              const T *a_panel = packed_a.data() + ir * kc;
+              T *c_tile = c + (ic + ir) * ldc + jc + jr;
+              if (ir + MR <= mc && jr + NR <= nc) {
+                gemm_kernel(kc, a_panel, b_panel, c_tile, ldc);
+              } else {
+                gemm_edge_kernel<T, MR, NR>(kc, a_panel, b_panel, c_tile, ldc,
+                                            std::min(MR, mc - ir), std::min(NR, nc - jr));
+              }
+            }
+          }
+        }
+      };
+      if (parallel) {
+        parallel_for(0, a_blocks, 1, multiply_blocks);
+      } else {
+        multiply_blocks(0, a_blocks);
+      }
+    }
+  }
+}
+
+#endif //LINEARALG_GEMM_H
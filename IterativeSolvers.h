@@ -0,0 +1,419 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_ITERATIVESOLVERS_H
+#define LINEARALG_ITERATIVESOLVERS_H
+
+#include <cmath>
+#include <vector>
+#include "Matrix.h"
+#include "SparseMatrix.h"
+
+// Итерационные методы Крылова: матрица нужна только как оператор y = A x, поэтому годятся Matrix, SparseMatrix
+// и любой объект, вызываемый как a(x, y). Предобусловливатель M задаётся методом apply(r, z): z = M^-1 r.
+// Все методы останавливаются, когда относительная невязка |b - A x| / |b| станет не больше tolerance.
+
+struct IterativeOptions {
+  double tolerance = 1e-10;
+  size_t max_iterations = 1000;
+  // Число шагов GMRES между перезапусками
+  size_t restart = 50;
+};
+
+template<typename T>
+struct IterativeSolution {
+  std::vector<T> x;
+  bool converged = false;
+  size_t iterations = 0;
+  // Относительная невязка после каждой итерации, первый элемент - для начального приближения
+  std::vector<double> residual_history;
+
+  double residual() const {
+    return residual_history.empty() ? 0 : residual_history.back();
+  }
+};
+
+template<typename T>
+void apply_linear_operator(const Matrix<T> &a, const std::vector<T> &x, std::vector<T> &y) {
+  parallel_for(0, a.vertical_size(), 256, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      const T *line = a[i];
+      T sum = T(0);
+      for (size_t j = 0; j < a.horizontal_size(); j++) {
+        sum += line[j] * x[j];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+template<typename T>
+void apply_linear_operator(const SparseMatrix<T> &a, const std::vector<T> &x, std::vector<T> &y) {
+  parallel_for(0, a.vertical_size(), 1024, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      T sum = T(0);
+      for (size_t p = a.row_offsets()[i]; p < a.row_offsets()[i + 1]; p++) {
+        sum += a.values()[p] * x[a.column_indices()[p]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+template<typename Operator, typename T>
+void apply_linear_operator(const Operator &a, const std::vector<T> &x, std::vector<T> &y) {
+  a(x, y);
+}
+
+template<typename T>
+class IdentityPreconditioner {
+ public:
+  void apply(const std::vector<T> &r, std::vector<T> &z) const {
+    z = r;
+  }
+};
+
+// M = diag(A); нулевые диагональные элементы заменяются единицами
+template<typename T>
+class JacobiPreconditioner {
+ public:
+  explicit JacobiPreconditioner(const Matrix<T> &a)
+          : inverse_diagonal_(a.vertical_size()) {
+    for (size_t i = 0; i < a.vertical_size(); i++) {
+      inverse_diagonal_[i] = a[i][i] == T(0) ? T(1) : T(1) / a[i][i];
+    }
+  }
+
+  explicit JacobiPreconditioner(const SparseMatrix<T> &a)
+          : inverse_diagonal_(a.vertical_size(), T(1)) {
+    for (size_t i = 0; i < a.vertical_size(); i++) {
+      for (size_t p = a.row_offsets()[i]; p < a.row_offsets()[i + 1]; p++) {
+        if (a.column_indices()[p] == i) {
+          inverse_diagonal_[i] = T(1) / a.values()[p];
+        }
+      }
+    }
+  }
+
+  void apply(const std::vector<T> &r, std::vector<T> &z) const {
+    for (size_t i = 0; i < r.size(); i++) {
+      z[i] = r[i] * inverse_diagonal_[i];
+    }
+  }
+
+ private:
+  std::vector<T> inverse_diagonal_;
+};
+
+// Неполное LU-разложение ILU(0): L и U имеют ту же структуру ненулей, что и A, всё заполнение отбрасывается.
+// Если на диагонали встретился ноль, разложение не строится и apply ничего не меняет
+template<typename T>
+class ILU0Preconditioner {
+ public:
+  explicit ILU0Preconditioner(const Matrix<T> &a)
+          : ILU0Preconditioner(SparseMatrix<T>(a)) {
+  }
+
+  explicit ILU0Preconditioner(const SparseMatrix<T> &a)
+          : factors_(a), values_(a.values()), diagonal_(a.vertical_size()) {
+    size_t n = a.vertical_size();
+    const std::vector<size_t> &offsets = factors_.row_offsets();
+    const std::vector<size_t> &columns = factors_.column_indices();
+    // position[j] - номер элемента (i, j) в values_ для текущей строки i
+    std::vector<size_t> position(n, NONE);
+    for (size_t i = 0; i < n && !singular_; i++) {
+      diagonal_[i] = NONE;
+      for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+        position[columns[p]] = p;
+        if (columns[p] == i) {
+          diagonal_[i] = p;
+        }
+      }
+      for (size_t p = offsets[i]; p < offsets[i + 1] && columns[p] < i; p++) {
+        size_t k = columns[p];
+        values_[p] /= values_[diagonal_[k]];
+        for (size_t q = diagonal_[k] + 1; q < offsets[k + 1]; q++) {
+          if (position[columns[q]] != NONE) {
+            values_[position[columns[q]]] -= values_[p] * values_[q];
+          }
+        }
+      }
+      if (diagonal_[i] == NONE || values_[diagonal_[i]] == T(0)) {
+        singular_ = true;
+      }
+      for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+        position[columns[p]] = NONE;
+      }
+    }
+  }
+
+  bool singular() const {
+    return singular_;
+  }
+
+  // z = U^-1 L^-1 r
+  void apply(const std::vector<T> &r, std::vector<T> &z) const {
+    if (singular_) {
+      z = r;
+      return;
+    }
+    size_t n = r.size();
+    const std::vector<size_t> &offsets = factors_.row_offsets();
+    const std::vector<size_t> &columns = factors_.column_indices();
+    for (size_t i = 0; i < n; i++) {
+      T sum = r[i];
+      for (size_t p = offsets[i]; p < diagonal_[i]; p++) {
+        sum -= values_[p] * z[columns[p]];
+      }
+      z[i] = sum;
+    }
+    for (size_t i = n; i-- > 0;) {
+      T sum = z[i];
+      for (size_t p = diagonal_[i] + 1; p < offsets[i + 1]; p++) {
+        sum -= values_[p] * z[columns[p]];
+      }
+      z[i] = sum / values_[diagonal_[i]];
+    }
+  }
+
+ private:
+  static constexpr size_t NONE = static_cast<size_t>(-1);
+
+  SparseMatrix<T> factors_;
+  std::vector<T> values_;
+  std::vector<size_t> diagonal_;
+  bool singular_ = false;
+};
+
+template<typename T>
+T vector_dot(const std::vector<T> &x, const std::vector<T> &y) {
+  T result = T(0);
+  for (size_t i = 0; i < x.size(); i++) {
+    result += x[i] * y[i];
+  }
+  return result;
+}
+
+template<typename T>
+T vector_norm(const std::vector<T> &x) {
+  return std::sqrt(vector_dot(x, x));
+}
+
+// r = b - A x, возвращает |r| / |b|
+template<typename Operator, typename T>
+double iterative_residual(const Operator &a, const std::vector<T> &b, const std::vector<T> &x,
+                          std::vector<T> &r, double b_norm) {
+  apply_linear_operator(a, x, r);
+  for (size_t i = 0; i < b.size(); i++) {
+    r[i] = b[i] - r[i];
+  }
+  return vector_norm(r) / b_norm;
+}
+
+// Метод сопряжённых градиентов для симметричной положительно определённой A;
+// предобусловливатель тоже должен быть симметричным положительно определённым
+template<typename T, typename Operator, typename Preconditioner = IdentityPreconditioner<T>>
+IterativeSolution<T> conjugate_gradient(const Operator &a, const std::vector<T> &b,
+                                        const IterativeOptions &options = IterativeOptions(),
+                                        const Preconditioner &preconditioner = Preconditioner(),
+                                        std::vector<T> initial = {}) {
+  size_t n = b.size();
+  IterativeSolution<T> solution;
+  solution.x = initial.empty() ? std::vector<T>(n, T(0)) : std::move(initial);
+  double b_norm = vector_norm(b) == T(0) ? 1 : vector_norm(b);
+  std::vector<T> r(n), z(n), p(n), ap(n);
+  solution.residual_history.push_back(iterative_residual(a, b, solution.x, r, b_norm));
+  preconditioner.apply(r, z);
+  p = z;
+  T rz = vector_dot(r, z);
+  while (solution.residual() > options.tolerance && solution.iterations < options.max_iterations) {
+    apply_linear_operator(a, p, ap);
+    T curvature = vector_dot(p, ap);
+    if (curvature == T(0)) {
+      break;
+    }
+    T alpha = rz / curvature;
+    for (size_t i = 0; i < n; i++) {
+      solution.x[i] += alpha * p[i];
+      r[i] -= alpha * ap[i];
+    }
+    solution.iterations++;
+    solution.residual_history.push_back(vector_norm(r) / b_norm);
+    preconditioner.apply(r, z);
+    T next_rz = vector_dot(r, z);
+    T beta = next_rz / rz;
+    rz = next_rz;
+    for (size_t i = 0; i < n; i++) {
+      p[i] = z[i] + beta * p[i];
+    }
+  }
+  solution.converged = solution.residual() <= options.tolerance;
+  return solution;
+}
+
+// Стабилизированный метод бисопряжённых градиентов для несимметричной A, предобусловливание справа
+template<typename T, typename Operator, typename Preconditioner = IdentityPreconditioner<T>>
+IterativeSolution<T> bicgstab(const Operator &a, const std::vector<T> &b,
+                              const IterativeOptions &options = IterativeOptions(),
+                              const Preconditioner &preconditioner = Preconditioner(),
+                              std::vector<T> initial = {}) {
+  size_t n = b.size();
+  IterativeSolution<T> solution;
+  solution.x = initial.empty() ? std::vector<T>(n, T(0)) : std::move(initial);
+  double b_norm = vector_norm(b) == T(0) ? 1 : vector_norm(b);
+  std::vector<T> r(n), p(n, T(0)), v(n, T(0)), s(n), t(n), p_hat(n), s_hat(n);
+  solution.residual_history.push_back(iterative_residual(a, b, solution.x, r, b_norm));
+  std::vector<T> shadow = r;
+  T rho = T(1);
+  T alpha = T(1);
+  T omega = T(1);
+  while (solution.residual() > options.tolerance && solution.iterations < options.max_iterations) {
+    T next_rho = vector_dot(shadow, r);
+    // Разрыв: r ортогонален теневой невязке, продолжать этим методом нельзя
+    if (next_rho == T(0) || omega == T(0)) {
+      break;
+    }
+    T beta = (next_rho / rho) * (alpha / omega);
+    rho = next_rho;
+    for (size_t i = 0; i < n; i++) {
+      p[i] = r[i] + beta * (p[i] - omega * v[i]);
+    }
+    preconditioner.apply(p, p_hat);
+    apply_linear_operator(a, p_hat, v);
+    T shadow_v = vector_dot(shadow, v);
+    if (shadow_v == T(0)) {
+      break;
+    }
+    alpha = rho / shadow_v;
+    for (size_t i = 0; i < n; i++) {
+      s[i] = r[i] - alpha * v[i];
+    }
+    solution.iterations++;
+    if (vector_norm(s) / b_norm <= options.tolerance) {
+      for (size_t i = 0; i < n; i++) {
+        solution.x[i] += alpha * p_hat[i];
+      }
+      omega = T(0);
+    } else {
+      preconditioner.apply(s, s_hat);
+      apply_linear_operator(a, s_hat, t);
+      T tt = vector_dot(t, t);
+      omega = tt == T(0) ? T(0) : vector_dot(t, s) / tt;
+      for (size_t i = 0; i < n; i++) {
+        solution.x[i] += alpha * p_hat[i] + omega * s_hat[i];
+        r[i] = s[i] - omega * t[i];
+      }
+    }
+    double residual = omega == T(0) ? vector_norm(s) / b_norm : vector_norm(r) / b_norm;
+    // Невязка из рекуррентных формул со временем расходится с настоящей, поэтому перед остановкой
+    // она пересчитывается, и если настоящая ещё велика, метод перезапускается с неё
+    if (residual <= options.tolerance || omega == T(0)) {
+      residual = iterative_residual(a, b, solution.x, r, b_norm);
+      shadow = r;
+      rho = alpha = omega = T(1);
+      std::fill(p.begin(), p.end(), T(0));
+      std::fill(v.begin(), v.end(), T(0));
+    }
+    solution.residual_history.push_back(residual);
+  }
+  solution.converged = solution.residual() <= options.tolerance;
+  return solution;
+}
+
+// GMRES с перезапуском через options.restart шагов и предобусловливанием справа. Базис Крылова строится
+// модифицированным процессом Грама-Шмидта, а малая задача наименьших квадратов решается вращениями Гивенса
+// по ходу, так что невязка известна на каждом шаге без вычисления x
+template<typename T, typename Operator, typename Preconditioner = IdentityPreconditioner<T>>
+IterativeSolution<T> gmres(const Operator &a, const std::vector<T> &b,
+                           const IterativeOptions &options = IterativeOptions(),
+                           const Preconditioner &preconditioner = Preconditioner(),
+                           std::vector<T> initial = {}) {
+  size_t n = b.size();
+  size_t m = std::max<size_t>(1, std::min(options.restart, n));
+  IterativeSolution<T> solution;
+  solution.x = initial.empty() ? std::vector<T>(n, T(0)) : std::move(initial);
+  double b_norm = vector_norm(b) == T(0) ? 1 : vector_norm(b);
+  std::vector<T> r(n), z(n), w(n);
+  std::vector<std::vector<T>> basis(m + 1, std::vector<T>(n));
+  // hessenberg[j] - столбец j верхней матрицы Хессенберга, уже повёрнутый
+  std::vector<std::vector<T>> hessenberg(m, std::vector<T>(m + 1));
+  std::vector<T> cosines(m), sines(m), g(m + 1), y(m);
+  solution.residual_history.push_back(iterative_residual(a, b, solution.x, r, b_norm));
+
+  while (solution.residual() > options.tolerance && solution.iterations < options.max_iterations) {
+    T beta = vector_norm(r);
+    for (size_t i = 0; i < n; i++) {
+      basis[0][i] = r[i] / beta;
+    }
+    std::fill(g.begin(), g.end(), T(0));
+    g[0] = beta;
+    size_t steps = 0;
+    while (steps < m && solution.iterations < options.max_iterations) {
+      size_t j = steps;
+      preconditioner.apply(basis[j], z);
+      apply_linear_operator(a, z, w);
+      std::vector<T> &column = hessenberg[j];
+      for (size_t i = 0; i <= j; i++) {
+        column[i] = vector_dot(w, basis[i]);
+        for (size_t k = 0; k < n; k++) {
+          w[k] -= column[i] * basis[i][k];
+        }
+      }
+      column[j + 1] = vector_norm(w);
+      if (column[j + 1] != T(0)) {
+        for (size_t k = 0; k < n; k++) {
+          basis[j + 1][k] = w[k] / column[j + 1];
+        }
+      }
+      for (size_t i = 0; i < j; i++) {
+        T rotated = cosines[i] * column[i] + sines[i] * column[i + 1];
+        column[i + 1] = -sines[i] * column[i] + cosines[i] * column[i + 1];
+        column[i] = rotated;
+      }
+      T length = std::hypot(column[j], column[j + 1]);
+      cosines[j] = length == T(0) ? T(1) : column[j] / length;
+      sines[j] = length == T(0) ? T(0) : column[j + 1] / length;
+      column[j] = length;
+      column[j + 1] = T(0);
+      g[j + 1] = -sines[j] * g[j];
+      g[j] = cosines[j] * g[j];
+
+      steps++;
+      solution.iterations++;
+      solution.residual_history.push_back(std::abs(g[j + 1]) / b_norm);
+      // Счастливый разрыв: пространство Крылова инвариантно, и решение в нём точное
+      if (solution.residual() <= options.tolerance || hessenberg[j][j] == T(0) || std::abs(g[j + 1]) == T(0)) {
+        break;
+      }
+    }
+
+    // H y = g обратным ходом, затем x += M^-1 (V y)
+    for (size_t i = steps; i-- > 0;) {
+      T sum = g[i];
+      for (size_t k = i + 1; k < steps; k++) {
+        sum -= hessenberg[k][i] * y[k];
+      }
+      y[i] = hessenberg[i][i] == T(0) ? T(0) : sum / hessenberg[i][i];
+    }
+    std::fill(w.begin(), w.end(), T(0));
+    for (size_t i = 0; i < steps; i++) {
+      for (size_t k = 0; k < n; k++) {
+        w[k] += y[i] * basis[i][k];
+      }
+    }
+    preconditioner.apply(w, z);
+    for (size_t k = 0; k < n; k++) {
+      solution.x[k] += z[k];
+    }
+    // Истинная невязка после перезапуска может немного отличаться от оценки из вращений
+    solution.residual_history.back() = iterative_residual(a, b, solution.x, r, b_norm);
+    if (steps == 0) {
+      break;
+    }
+  }
+  solution.converged = solution.residual() <= options.tolerance;
+  return solution;
+}
+
+#endif //LINEARALG_ITERATIVESOLVERS_H
@@ -0,0 +1,334 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_LU_H
+#define LINEARALG_LU_H
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <vector>
+#include "Matrix.h"
+
+// Ниже этого размера блоки обрабатываются построчно, выше - делятся пополам
+constexpr size_t LU_BLOCK_SIZE = 32;
+
+// x = L^-1 x, где L - единичная нижнетреугольная часть квадратного блока lower
+template<typename T>
+void solve_unit_lower(typename MatrixView<T>::const_view lower, MatrixView<T> x) {
+  size_t n = lower.vertical_size();
+  size_t width = x.horizontal_size();
+  if (n <= LU_BLOCK_SIZE) {
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < i; j++) {
+        vector_sub_scaled(width, lower(i, j), x[j], x[i]);
+      }
+    }
+    return;
+  }
+  size_t half = n / 2;
+  solve_unit_lower(lower.view(0, 0, half, half), x.view(0, 0, half, width));
+  multiply_subtract<T>(x.view(half, 0, n, width), lower.view(half, 0, n, half), x.view(0, 0, half, width));
+  solve_unit_lower(lower.view(half, half, n, n), x.view(half, 0, n, width));
+}
+
+// x = U^-1 x, где U - верхнетреугольная часть квадратного блока upper вместе с диагональю
+template<typename T>
+void solve_upper(typename MatrixView<T>::const_view upper, MatrixView<T> x) {
+  size_t n = upper.vertical_size();
+  size_t width = x.horizontal_size();
+  if (n <= LU_BLOCK_SIZE) {
+    for (size_t i = n; i-- > 0;) {
+      for (size_t j = i + 1; j < n; j++) {
+        vector_sub_scaled(width, upper(i, j), x[j], x[i]);
+      }
+      T *line = x[i];
+      for (size_t j = 0; j < width; j++) {
+        line[j] /= upper(i, i);
+      }
+    }
+    return;
+  }
+  size_t half = n / 2;
+  solve_upper(upper.view(half, half, n, n), x.view(half, 0, n, width));
+  multiply_subtract<T>(x.view(0, 0, half, width), upper.view(0, half, half, n), x.view(half, 0, n, width));
+  solve_upper(upper.view(0, 0, half, half), x.view(0, 0, half, width));
+}
+
+// Разложение PA = LU с выбором главного элемента по столбцу. Считается один раз за O(n^3),
+// после чего каждая правая часть решается за O(n^2).
+// L хранится под диагональю factors() (единицы на диагонали не хранятся), U - на диагонали и выше.
+template<typename T>
+class LU {
+ public:
+  explicit LU(Matrix<T> matrix)
+          : factors_(std::move(matrix)), permutation_(factors_.vertical_size()) {
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+    factorize();
+  }
+
+  size_t size() const {
+    return factors_.vertical_size();
+  }
+
+  bool singular() const {
+    return singular_;
+  }
+
+  const Matrix<T> &factors() const {
+    return factors_;
+  }
+
+  // Строка i матрицы PA - это строка permutation()[i] исходной матрицы
+  const std::vector<size_t> &permutation() const {
+    return permutation_;
+  }
+
+  T determinant() const {
+    if (singular_) {
+      return T(0);
+    }
+    T result = T(sign_);
+    for (size_t i = 0; i < size(); i++) {
+      result *= factors_[i][i];
+    }
+    return result;
+  }
+
+  // Для вырожденной матрицы возвращает пустой вектор
+  std::vector<T> solve(const std::vector<T> &b) const {
+    if (singular_) {
+      return {};
+    }
+    std::vector<T> result(size());
+    for (size_t i = 0; i < size(); i++) {
+      result[i] = b[permutation_[i]];
+    }
+    for (size_t i = 0; i < size(); i++) {
+      const T *line = factors_[i];
+      for (size_t j = 0; j < i; j++) {
+        result[i] -= line[j] * result[j];
+      }
+    }
+    for (size_t i = size(); i-- > 0;) {
+      const T *line = factors_[i];
+      for (size_t j = i + 1; j < size(); j++) {
+        result[i] -= line[j] * result[j];
+      }
+      result[i] /= line[i];
+    }
+    return result;
+  }
+
+  // Решает сразу для всех столбцов b. Для вырожденной матрицы возвращает пустую матрицу
+  Matrix<T> solve(const Matrix<T> &b) const {
+    if (singular_) {
+      return Matrix<T>();
+    }
+    Matrix<T> result(b.horizontal_size(), size());
+    for (size_t i = 0; i < size(); i++) {
+      std::copy(b[permutation_[i]], b[permutation_[i]] + b.horizontal_size(), result[i]);
+    }
+    // Блочные прямой и обратный ход: основная работа - умножения блоков, которые сами делятся между потоками
+    solve_unit_lower<T>(factors_.view(), result.view());
+    solve_upper<T>(factors_.view(), result.view());
+    return result;
+  }
+
+  // Для вырожденной матрицы возвращает пустую матрицу, как и Matrix::inverse
+  Matrix<T> inverse() const {
+    return solve(Identity<T>(size()));
+  }
+
+ private:
+  Matrix<T> factors_;
+  std::vector<size_t> permutation_;
+  int sign_ = 1;
+  bool singular_ = false;
+
+  // Рекурсивное разложение по столбцам: левая половина раскладывается, правая обновляется через gemm.
+  // Так почти вся работа приходится на умножение блоков, а не на построчные вычитания
+  void factorize() {
+    factorize_panel(0, size());
+  }
+
+  // Раскладывает столбцы [column, column + width) ниже строки column, строки переставляются целиком
+  void factorize_panel(size_t column, size_t width) {
+    size_t n = size();
+    MatrixView<T> factors = factors_.view();
+    if (width <= LU_BLOCK_SIZE) {
+      size_t end = column + width;
+      for (size_t k = column; k < end; k++) {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; i++) {
+          if (my_abs(factors(i, k)) > my_abs(factors(pivot, k))) {
+            pivot = i;
+          }
+        }
+        if (factors(pivot, k) == T(0)) {
+          singular_ = true;
+          continue;
+        }
+        if (pivot != k) {
+          factors.swap_lines(pivot, k);
+          std::swap(permutation_[pivot], permutation_[k]);
+          sign_ = -sign_;
+        }
+
+        const T *pivot_line = factors[k];
+        auto eliminate = [&](size_t first, size_t last) {
+          for (size_t i = first; i < last; i++) {
+            T *line = factors[i];
+            line[k] /= pivot_line[k];
+            vector_sub_scaled(end - k - 1, line[k], pivot_line + k + 1, line + k + 1);
+          }
+        };
+        if ((n - k) * (end - k) >= 1 << 15) {
+          parallel_for(k + 1, n, 64, eliminate);
+        } else {
+          eliminate(k + 1, n);
+        }
+      }
+      return;
+    }
+
+    size_t half = width / 2;
+    size_t middle = column + half;
+    size_t end = column + width;
+    factorize_panel(column, half);
+    MatrixView<T> upper = factors.view(column, middle, middle, end);
+    solve_unit_lower<T>(factors.view(column, column, middle, middle), upper);
+    multiply_subtract<T>(factors.view(middle, middle, n, end), factors.view(middle, column, n, middle), upper);
+    factorize_panel(middle, width - half);
+  }
+};
+
+// Во сколько раз невязка должна уменьшиться за шаг уточнения в MixedPrecisionLU, иначе оно считается застрявшим
+constexpr double MIXED_PRECISION_MIN_REDUCTION = 0.5;
+
+template<typename T>
+struct MixedPrecisionSolution {
+  // Пуст для вырожденной матрицы
+  std::vector<T> x;
+  // Сделанные шаги уточнения; если refined == false, они не помогли и x получен разложением в T
+  size_t iterations = 0;
+  bool refined = false;
+};
+
+// Решение в смешанной точности: A раскладывается в типе Low (float вдвое шире в векторных регистрах и вдвое
+// легче для памяти), а точность T восстанавливается итерационным уточнением: невязка b - A x считается в T
+// по исходной матрице, поправка - по разложению в Low. Если невязка за шаг уменьшается меньше чем
+// в MIXED_PRECISION_MIN_REDUCTION раз (уточнение застряло или расходится), если за max_iterations шагов
+// точность не достигнута или A не представима в Low, решение считается полным разложением в T. Оно строится
+// при первой такой неудаче и дальше переиспользуется; solve можно вызывать из нескольких потоков сразу.
+template<typename T, typename Low = float>
+class MixedPrecisionLU {
+ public:
+  explicit MixedPrecisionLU(Matrix<T> matrix, size_t max_iterations = 30)
+          : matrix_(std::move(matrix)), max_iterations_(max_iterations) {
+    norm_ = T(0);
+    for (size_t i = 0; i < size(); i++) {
+      T sum = T(0);
+      for (size_t j = 0; j < size(); j++) {
+        sum += std::abs(matrix_[i][j]);
+      }
+      norm_ = std::max(norm_, sum);
+    }
+    // Элементы, которые переполняют Low, сделали бы разложение бессмысленным
+    representable_ = norm_ <= T(std::numeric_limits<Low>::max());
+    if (representable_) {
+      low_ = LU<Low>(Matrix<Low>(matrix_));
+    }
+  }
+
+  size_t size() const {
+    return matrix_.vertical_size();
+  }
+
+  MixedPrecisionSolution<T> solve(const std::vector<T> &b) const {
+    size_t n = size();
+    MixedPrecisionSolution<T> solution;
+    if (representable_ && !low_.singular()) {
+      std::vector<T> x(n, T(0));
+      std::vector<T> residual = b;
+      std::vector<Low> correction(n);
+      // Критерий остановки как у LAPACK dsgesv: |r| <= |x| |A| eps sqrt(n) в норме максимума
+      T threshold = norm_ * std::numeric_limits<T>::epsilon() * std::sqrt(T(n));
+      T previous_norm = std::numeric_limits<T>::infinity();
+      for (; solution.iterations <= max_iterations_; solution.iterations++) {
+        if (solution.iterations != 0) {
+          compute_residual(b, x, residual);
+        }
+        T residual_norm = T(0);
+        T solution_norm = T(0);
+        for (size_t i = 0; i < n; i++) {
+          residual_norm = std::max(residual_norm, std::abs(residual[i]));
+          solution_norm = std::max(solution_norm, std::abs(x[i]));
+        }
+        if (solution.iterations != 0 && residual_norm <= solution_norm * threshold) {
+          solution.x = std::move(x);
+          solution.refined = true;
+          return solution;
+        }
+        // Сравнение записано так, чтобы NaN тоже останавливал уточнение
+        if (!(residual_norm <= previous_norm * T(MIXED_PRECISION_MIN_REDUCTION)) || std::isinf(residual_norm)) {
+          break;
+        }
+        previous_norm = residual_norm;
+        // Невязка масштабируется, чтобы её малые компоненты не уходили в денормализованные числа Low
+        T scale = residual_norm == T(0) ? T(1) : residual_norm;
+        for (size_t i = 0; i < n; i++) {
+          correction[i] = Low(residual[i] / scale);
+        }
+        correction = low_.solve(correction);
+        for (size_t i = 0; i < n; i++) {
+          x[i] += scale * T(correction[i]);
+        }
+      }
+      solution.iterations = std::min(solution.iterations, max_iterations_);
+    }
+    solution.x = full().solve(b);
+    return solution;
+  }
+
+ private:
+  Matrix<T> matrix_;
+  LU<Low> low_ = LU<Low>(Matrix<Low>());
+  T norm_;
+  bool representable_;
+  size_t max_iterations_;
+  // Разложение в T для случаев, когда уточнение не помогло
+  mutable std::once_flag full_once_;
+  mutable std::unique_ptr<LU<T>> full_;
+
+  const LU<T> &full() const {
+    std::call_once(full_once_, [&] {
+      full_ = std::make_unique<LU<T>>(matrix_);
+    });
+    return *full_;
+  }
+
+  void compute_residual(const std::vector<T> &b, const std::vector<T> &x, std::vector<T> &residual) const {
+    size_t n = size();
+    auto rows = [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        const T *line = matrix_[i];
+        T sum = b[i];
+        for (size_t j = 0; j < n; j++) {
+          sum -= line[j] * x[j];
+        }
+        residual[i] = sum;
+      }
+    };
+    if (n * n >= 1 << 16) {
+      parallel_for(0, n, 64, rows);
+    } else {
+      rows(0, n);
+    }
+  }
+};
+
+#endif //LINEARALG_LU_H
@@ -5,10 +5,18 @@
 #ifndef LINEARALG_MATRIX_H
 #define LINEARALG_MATRIX_H
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <type_traits>
 #include <vector>
+#include "Arena.h"
+#include "MatrixExpression.h"
+#include "MatrixView.h"
 #include "Permutation.h"
 #include "Polynominal.h"
+#include "Strassen.h"
+#include "Transpose.h"
 
 template<typename T>
 class Matrix;
@@ -17,52 +25,278 @@ template<typename T>
 Matrix<T> Identity(int);
 
 template<typename T>
-T my_abs(T value) {
-  if (value < 0) {
-    return -value;
-  }
-  return value;
-}
+class LU;
+
+template<typename T>
+class QR;
+
+template<typename T, typename Low>
+class MixedPrecisionLU;
 
 template<typename T>
-class Matrix {
+class Matrix : public MatrixExpression<Matrix<T>> {
  private:
-  std::vector<std::vector<T>> data_;
+  // Элементы хранятся построчно в одном буфере, строка i начинается с data_[i * stride_]
+  ArenaVector<T> data_;
+  size_t vertical_size_ = 0;
+  size_t horizontal_size_ = 0;
+  size_t stride_ = 0;
+
+  // Многочлен ведущего блока k x k получается из многочлена блока (k - 1) x (k - 1) умножением
+  // на тёплицеву матрицу из чисел 1, -a_kk, -R C, -R A C, -R A^2 C, ..., где A - ведущий блок,
+  // R и C - новые строка и столбец. Коэффициенты хранятся от старшего к младшему.
+  Polynomial<T> berkowitz_characteristic_polynomial() const {
+    size_t n = vertical_size();
+    if (n == 0) {
+      return Polynomial<T>(T(1));
+    }
+    ArenaVector<T> coefficients = {T(1), -(*this)[0][0]};
+    ArenaVector<T> items;
+    ArenaVector<T> power_column;
+    ArenaVector<T> next_power_column;
+    for (size_t k = 1; k < n; k++) {
+      items.assign(k + 2, T(0));
+      items[0] = T(1);
+      items[1] = -(*this)[k][k];
+
+      // power_column = A^i C, items[i + 2] = -R A^i C
+      power_column.resize(k);
+      for (size_t i = 0; i < k; i++) {
+        power_column[i] = (*this)[i][k];
+      }
+      for (size_t power = 0; power < k; power++) {
+        T value = T(0);
+        for (size_t j = 0; j < k; j++) {
+          value += (*this)[k][j] * power_column[j];
+        }
+        items[power + 2] = -value;
+        if (power + 1 == k) {
+          break;
+        }
+        next_power_column.assign(k, T(0));
+        for (size_t i = 0; i < k; i++) {
+          const T *current_line = (*this)[i];
+          for (size_t j = 0; j < k; j++) {
+            next_power_column[i] += current_line[j] * power_column[j];
+          }
+        }
+        std::swap(power_column, next_power_column);
+      }
+
+      ArenaVector<T> next_coefficients(k + 2, T(0));
+      for (size_t i = 0; i < k + 2; i++) {
+        for (size_t j = 0; j <= std::min(i, k); j++) {
+          next_coefficients[i] += items[i - j] * coefficients[j];
+        }
+      }
+      std::swap(coefficients, next_coefficients);
+    }
+    std::reverse(coefficients.begin(), coefficients.end());
+    return Polynomial<T>(coefficients);
+  }
+
+  // Подобием с выбором главного элемента приводим матрицу к верхней форме Хессенберга H,
+  // затем p_k = (x - h_kk) p_(k-1) - sum_i h_ik h_(i+1)i ... h_k(k-1) p_(i-1)
+  Polynomial<T> hessenberg_characteristic_polynomial() const {
+    size_t n = vertical_size();
+    Matrix hessenberg = *this;
+    MatrixView<T> h = hessenberg.view();
+    for (size_t m = 1; m + 1 < n; m++) {
+      size_t pivot = m;
+      for (size_t i = m + 1; i < n; i++) {
+        if (my_abs(h(i, m - 1)) > my_abs(h(pivot, m - 1))) {
+          pivot = i;
+        }
+      }
+      T pivot_value = h(pivot, m - 1);
+      if (pivot_value == T(0)) {
+        continue;
+      }
+      if (pivot != m) {
+        h.swap_lines(pivot, m);
+        for (size_t j = 0; j < n; j++) {
+          std::swap(h(j, pivot), h(j, m));
+        }
+      }
+      for (size_t i = m + 1; i < n; i++) {
+        T coefficient = h(i, m - 1) / pivot_value;
+        if (coefficient == T(0)) {
+          continue;
+        }
+        h(i, m - 1) = T(0);
+        vector_sub_scaled(n - m, coefficient, h[m] + m, h[i] + m);
+        for (size_t j = 0; j < n; j++) {
+          h(j, m) += coefficient * h(j, i);
+        }
+      }
+    }
+
+    ArenaVector<ArenaVector<T>> polynomials(n + 1);
+    polynomials[0] = {T(1)};
+    for (size_t k = 1; k <= n; k++) {
+      ArenaVector<T> &current = polynomials[k];
+      const ArenaVector<T> &previous = polynomials[k - 1];
+      current.assign(k + 1, T(0));
+      for (size_t i = 0; i < k; i++) {
+        current[i + 1] += previous[i];
+        current[i] -= h(k - 1, k - 1) * previous[i];
+      }
+      T product = T(1);
+      for (size_t i = k - 1; i >= 1; i--) {
+        product *= h(i, i - 1);
+        T coefficient = h(i - 1, k - 1) * product;
+        for (size_t j = 0; j < polynomials[i - 1].size(); j++) {
+          current[j] -= coefficient * polynomials[i - 1][j];
+        }
+      }
+    }
+    return Polynomial<T>(polynomials[n]);
+  }
+
+  // После шага k все элементы правее и ниже (k, k) - миноры порядка k + 1 исходной матрицы,
+  // поэтому деление на предыдущий ведущий элемент всегда нацело и числа не раздуваются.
+  // Разность произведений для целых T считается во вдвое более широком типе и сужается
+  // только после деления, так что достаточно, чтобы в T помещались сами миноры
+  T bareiss_determinant() const {
+    using Wide = typename WideProduct<T>::type;
+    size_t n = vertical_size();
+    Matrix copy = *this;
+    MatrixView<T> minors = copy.view();
+    T sign = T(1);
+    T previous_pivot = T(1);
+    for (size_t k = 0; k + 1 < n; k++) {
+      if (minors(k, k) == T(0)) {
+        size_t pivot = k + 1;
+        while (pivot < n && minors(pivot, k) == T(0)) {
+          pivot++;
+        }
+        if (pivot == n) {
+          return T(0);
+        }
+        minors.swap_lines(k, pivot);
+        sign = -sign;
+      }
+      const T *pivot_line = minors[k];
+      auto eliminate = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+          T *current_line = minors[i];
+          for (size_t j = k + 1; j < n; j++) {
+            current_line[j] = T((Wide(current_line[j]) * pivot_line[k] - Wide(current_line[k]) * pivot_line[j])
+                                / previous_pivot);
+          }
+        }
+      };
+      if ((n - k) * (n - k) >= 1 << 12) {
+        parallel_for(k + 1, n, 4, eliminate);
+      } else {
+        eliminate(k + 1, n);
+      }
+      previous_pivot = pivot_line[k];
+    }
+    return n == 0 ? T(1) : sign * minors(n - 1, n - 1);
+  }
+
+  T *line(size_t position) {
+    return data_.data() + position * stride_;
+  }
+
+  const T *line(size_t position) const {
+    return data_.data() + position * stride_;
+  }
 
  public:
+  using value_type = T;
+
   size_t vertical_size() const {
-    return data_.size();
+    return vertical_size_;
   }
 
   size_t horizontal_size() const {
-    if (!data_.empty()) {
-      return data_[0].size();
-    } else {
-      return 0;
-    }
+    return horizontal_size_;
+  }
+
+  size_t stride() const {
+    return stride_;
+  }
+
+  T *data() {
+    return data_.data();
+  }
+
+  const T *data() const {
+    return data_.data();
+  }
+
+  MatrixView<T> view() {
+    return MatrixView<T>(data(), vertical_size_, horizontal_size_, stride_);
+  }
+
+  MatrixView<const T> view() const {
+    return MatrixView<const T>(data(), vertical_size_, horizontal_size_, stride_);
+  }
+
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return view().aliases(destination);
+  }
+
+  // Блок строк [top, bottom) и столбцов [left, right) без копирования, в отличие от cutted
+  MatrixView<T> view(size_t top, size_t left, size_t bottom, size_t right) {
+    return view().view(top, left, bottom, right);
+  }
+
+  MatrixView<const T> view(size_t top, size_t left, size_t bottom, size_t right) const {
+    return view().view(top, left, bottom, right);
   }
 
   Matrix() {
 
   }
 
-  Matrix(int horizontal_size, int vertical_size) {
-    data_.resize(vertical_size);
-    for (auto &line : data_) {
-      line.resize(horizontal_size);
-    }
+  Matrix(int horizontal_size, int vertical_size)
+          : data_(static_cast<size_t>(horizontal_size) * vertical_size),
+            vertical_size_(vertical_size),
+            horizontal_size_(horizontal_size),
+            stride_(horizontal_size) {
   }
 
-  Matrix(const std::vector<std::vector<T>> &data) : data_(data) {
+  Matrix(const std::vector<std::vector<T>> &data) {
+    vertical_size_ = data.size();
+    horizontal_size_ = data.empty() ? 0 : data[0].size();
+    stride_ = horizontal_size_;
+    data_.reserve(vertical_size_ * stride_);
+    for (const auto &line : data) {
+      data_.insert(data_.end(), line.begin(), line.end());
+    }
   }
 
   Matrix(std::initializer_list<std::initializer_list<T>> data) {
+    vertical_size_ = data.size();
+    horizontal_size_ = data.size() == 0 ? 0 : data.begin()->size();
+    stride_ = horizontal_size_;
+    data_.reserve(vertical_size_ * stride_);
     for (auto line : data) {
-      data_.push_back(std::vector<T>());
-      for (auto item : line) {
-        data_.back().push_back(item);
-      }
+      data_.insert(data_.end(), line.begin(), line.end());
+    }
+  }
+
+  template<typename E>
+  Matrix(const MatrixExpression<E> &expression)
+          : Matrix(expression.horizontal_size(), expression.vertical_size()) {
+    view() = expression;
+  }
+
+  template<typename E>
+  Matrix &operator=(const MatrixExpression<E> &expression) {
+    // Поэлементное выражение читает (i, j) только перед записью в (i, j), поэтому *this может в нём участвовать.
+    // Выражение, читающее *this по другим индексам (S = S^T), вычисляется в новую матрицу
+    if (vertical_size() == expression.vertical_size() && horizontal_size() == expression.horizontal_size()
+        && !expression.aliases(view())) {
+      view() = expression;
+    } else {
+      *this = Matrix(expression);
     }
+    return *this;
   }
 
   std::pair<size_t, size_t> size() const {
@@ -70,146 +304,90 @@ class Matrix {
   }
 
   friend std::ostream &operator<<(std::ostream &out, const Matrix &matrix) {
-    out << "(";
-    for (size_t i = 0; i < matrix.size().first; i++) {
-      if (i != 0) {
-        out << ",\n";
-      }
-      out << "(";
-      for (size_t j = 0; j < matrix.size().second; j++) {
-        if (j != 0) {
-          out << ", ";
-        }
-        out << matrix.data_[i][j];
-      }
-      out << ")";
-    }
-    out << ")";
-    return out;
+    return out << matrix.view();
   }
 
-  const std::vector<T> &operator[](int position) const {
-    return data_[position];
+  const T *operator[](size_t position) const {
+    return line(position);
   }
 
-  std::vector<T> &operator[](int position) {
-    return data_[position];
+  T *operator[](size_t position) {
+    return line(position);
+  }
+
+  const T &operator()(size_t i, size_t j) const {
+    return line(i)[j];
   }
 
   Matrix &operator+=(const Matrix &other) {
-    for (size_t i = 0; i < vertical_size(); i++) {
-      for (size_t j = 0; j < horizontal_size(); j++) {
-        this->data_[i][j] += other.data_[i][j];
-      }
-    }
+    view() += other.view();
     return *this;
   }
 
-  Matrix operator+(const Matrix &other) const {
-    Matrix tmp = Matrix(*this);
-    tmp += other;
-    return tmp;
+  template<typename E>
+  Matrix &operator+=(const MatrixExpression<E> &expression) {
+    view() += expression;
+    return *this;
   }
 
   Matrix &operator-=(const Matrix &other) {
-    (*this) += (-other);
+    view() -= other.view();
     return *this;
   }
 
-  Matrix operator-(const Matrix &other) const {
-    return (*this) + (-other);
-  }
-
-  template<typename S>
-  Matrix operator*=(const S &scalar) {
-    for (size_t i = 0; i < vertical_size(); i++) {
-      for (size_t j = 0; j < horizontal_size(); j++) {
-        this->data_[i][j] *= scalar;
-      }
-    }
+  template<typename E>
+  Matrix &operator-=(const MatrixExpression<E> &expression) {
+    view() -= expression;
     return *this;
   }
 
-  template<typename S>
-  Matrix operator*(const S &scalar) const {
-    Matrix tmp = Matrix(*this);
-    tmp *= scalar;
-    return tmp;
+  template<typename S, typename = std::enable_if_t<!is_matrix_expression<S>::value>>
+  Matrix &operator*=(const S &scalar) {
+    view() *= scalar;
+    return *this;
   }
 
   Matrix &operator*=(const Matrix &other) {
-    std::vector<std::vector<T>> new_data(vertical_size());
-    for (auto &line : new_data) {
-      line.resize(other.horizontal_size());
-    }
-
-    Matrix other_transposed = other.transposed();
-    for (size_t i = 0; i < vertical_size(); i++) {
-      for (size_t j = 0; j < other.horizontal_size(); j++) {
-        T sum = T(0);
-        for (size_t k = 0; k < horizontal_size(); k++) {
-          sum += data_[i][k] * other_transposed.data_[j][k];
-        }
-        new_data[i][j] = sum;
-      }
-    }
-    data_ = new_data;
+    Matrix result(other.horizontal_size(), vertical_size());
+    multiply(result.view(), view(), other.view());
+    *this = std::move(result);
     return *this;
   }
 
-  Matrix operator*(const Matrix &other) const {
-    Matrix tmp = Matrix(*this);
-    tmp *= other;
-    return tmp;
+  template<typename E>
+  Matrix &operator*=(const MatrixExpression<E> &expression) {
+    *this = (*this) * expression.self();
+    return *this;
   }
 
   Matrix &transpose() {
-    std::vector<std::vector<T>> new_data(horizontal_size());
-    for (auto &line : new_data) {
-      line.resize(vertical_size());
-    }
-    for (size_t i = 0; i < vertical_size(); i++) {
-      for (size_t j = 0; j < horizontal_size(); j++) {
-        new_data[j][i] = data_[i][j];
-      }
+    if (vertical_size() == horizontal_size()) {
+      transpose_square(view());
+    } else {
+      *this = transposed();
     }
-    data_ = new_data;
     return *this;
   }
 
-  Matrix transposed() const {
-    Matrix tmp = *this;
-    tmp.transpose();
-    return tmp;
+  Matrix transposed() const & {
+    Matrix result(vertical_size(), horizontal_size());
+    transpose_into<T>(view(), result.view());
+    return result;
   }
 
-  Matrix &make_gauss() {
-    for (size_t column = 0, row = 0; row < vertical_size() && column < horizontal_size(); row++, column++) {
-      size_t max_element_row = row;
-      T coefficient = T(0);
-      while (coefficient == T(0) && column < horizontal_size()) {
-        for (size_t j = row + 1; j < vertical_size(); j++) {
-          if (my_abs(data_[j][column]) > my_abs(data_[max_element_row][column])) {
-            max_element_row = j;
-          }
-        }
-        coefficient = data_[max_element_row][column];
-        column++;
-      }
-      column--;
-      std::swap(data_[row], data_[max_element_row]);
+  // Временная квадратная матрица транспонируется на месте и отдаёт свой буфер
+  Matrix transposed() && {
+    transpose();
+    return std::move(*this);
+  }
 
-      for (size_t k = 0; k < horizontal_size(); k++) {
-        data_[row][k] /= coefficient;
-      }
-      for (size_t j = 0; j < vertical_size(); j++) {
-        if (j == row) continue;
-        T current_coefficient = data_[j][column];
-        for (size_t k = 0; k < horizontal_size(); k++) {
-          data_[j][k] -= data_[row][k] * current_coefficient;
-        }
-      }
-    }
+  // A^T без копирования; умножение на такой взгляд не транспонирует матрицу явно
+  TransposedMatrixView<const T> transposed_view() const {
+    return view().transposed();
+  }
+
+  Matrix &make_gauss() {
+    view().make_gauss();
     return *this;
   }
 
@@ -226,48 +404,210 @@ class Matrix {
     return result;
   }
 
-  Matrix gauss() const {
+  // O(n^3): LU с выбором главного элемента для чисел с плавающей точкой,
+  // метод Барейса без дробей для целых и точных типов
+  T determinant() const {
+    if constexpr (std::is_floating_point<T>::value) {
+      return LU<T>(*this).determinant();
+    } else {
+      return bareiss_determinant();
+    }
+  }
+
+  Matrix gauss() const & {
     Matrix copy = *this;
     copy.make_gauss();
     return copy;
   }
 
+  Matrix gauss() && {
+    make_gauss();
+    return std::move(*this);
+  }
+
+  // Ступенчатый вид без нормировки и обратного хода, см. MatrixView::make_row_echelon
+  std::vector<size_t> make_row_echelon() {
+    return view().make_row_echelon();
+  }
+
+  Matrix row_echelon() const & {
+    Matrix copy = *this;
+    copy.make_row_echelon();
+    return copy;
+  }
+
+  Matrix row_echelon() && {
+    make_row_echelon();
+    return std::move(*this);
+  }
+
+  // Номера столбцов, в которых стоят ведущие элементы ступенчатого вида
+  std::vector<size_t> pivot_columns() const {
+    return Matrix(*this).make_row_echelon();
+  }
+
+  // Строки по очереди приводятся по уже найденному базису из линейно независимых строк, и ненулевой остаток
+  // пополняет базис. Как только базис достигает min(m, n) строк, ответ известен и остальные строки не читаются:
+  // для высокой матрицы полного ранга это O(n^3) вместо O(m n^2), и сама матрица не копируется.
+  // Для чисел с плавающей точкой так нельзя: без выбора ведущей строки после малого ведущего элемента шум
+  // в остатках растёт. Для встроенных целых - тоже: деление отбрасывает остаток. В обоих случаях ранг - число
+  // ведущих элементов make_row_echelon, как у null_space и column_space
+  size_t rank() const {
+    if constexpr (std::is_floating_point<T>::value || std::is_integral<T>::value) {
+      return pivot_columns().size();
+    } else {
+      size_t n = horizontal_size();
+      size_t limit = std::min(vertical_size(), n);
+      // Строка базиса i равна нулю в ведущих столбцах строк, добавленных до неё
+      Matrix basis(n, limit);
+      std::vector<size_t> pivots;
+      for (size_t row = 0; row < vertical_size() && pivots.size() < limit; row++) {
+        T *line = basis[pivots.size()];
+        std::copy((*this)[row], (*this)[row] + n, line);
+        for (size_t i = 0; i < pivots.size(); i++) {
+          if (line[pivots[i]] != T(0)) {
+            vector_sub_scaled(n, line[pivots[i]] / basis[i][pivots[i]], basis[i], line);
+          }
+        }
+        size_t pivot = 0;
+        while (pivot < n && line[pivot] == T(0)) {
+          pivot++;
+        }
+        if (pivot < n) {
+          pivots.push_back(pivot);
+        }
+      }
+      return pivots.size();
+    }
+  }
+
+  // Базис образа: столбцы исходной матрицы с ведущими элементами, m x rank
+  Matrix column_space() const {
+    std::vector<size_t> pivots = pivot_columns();
+    Matrix result(pivots.size(), vertical_size());
+    for (size_t i = 0; i < vertical_size(); i++) {
+      for (size_t j = 0; j < pivots.size(); j++) {
+        result[i][j] = (*this)[i][pivots[j]];
+      }
+    }
+    return result;
+  }
+
+  // Базис ядра по столбцам, n x (n - rank): каждый столбец - решение A x = 0, в котором одна свободная
+  // переменная равна единице, а остальные свободные - нулю. Для встроенных целых свободная переменная равна
+  // последнему ведущему элементу ступенчатого вида Бареисса - минору при ведущих строках и столбцах, и по
+  // правилу Крамера остальные компоненты целые, а деления обратного хода точные
+  Matrix null_space() const {
+    Matrix echelon = *this;
+    std::vector<size_t> pivots = echelon.make_row_echelon();
+    size_t n = horizontal_size();
+    std::vector<bool> is_pivot(n, false);
+    for (size_t column : pivots) {
+      is_pivot[column] = true;
+    }
+    using Wide = typename WideProduct<T>::type;
+    Matrix result(n - pivots.size(), n);
+    std::vector<T> x(n);
+    for (size_t free = 0, index = 0; free < n; free++) {
+      if (is_pivot[free]) {
+        continue;
+      }
+      std::fill(x.begin(), x.end(), T(0));
+      x[free] = T(1);
+      if constexpr (std::is_integral<T>::value) {
+        if (!pivots.empty()) {
+          x[free] = echelon[pivots.size() - 1][pivots.back()];
+        }
+      }
+      for (size_t i = pivots.size(); i-- > 0;) {
+        const T *line = echelon[i];
+        Wide sum = Wide(0);
+        for (size_t j = pivots[i] + 1; j < n; j++) {
+          sum += Wide(line[j]) * x[j];
+        }
+        x[pivots[i]] = T(-sum / line[pivots[i]]);
+      }
+      for (size_t j = 0; j < n; j++) {
+        result[j][index] = x[j];
+      }
+      index++;
+    }
+    return result;
+  }
+
+  // Для многократного решения с одной и той же матрицей лучше один раз построить lu()
+  LU<T> lu() const {
+    return LU<T>(*this);
+  }
+
+  // Для квадратной матрицы double: разложение во float с уточнением до точности double, примерно вдвое быстрее solve
+  std::vector<T> mixed_precision_solve(const std::vector<T> &b) const {
+    return MixedPrecisionLU<T, float>(*this).solve(b).x;
+  }
+
   template<typename U>
-  std::vector<U> solve(const std::vector<U> &b) {
-    std::vector<std::vector<U>> copied_data;
-    for (const auto &line : data_) {
-      copied_data.emplace_back(line.begin(), line.end());
+  std::vector<U> solve(const std::vector<U> &b) const {
+    if (vertical_size() == horizontal_size()) {
+      return LU<U>(Matrix<U>(*this)).solve(b);
     }
+
+    Matrix<U> augmented(horizontal_size() + 1, vertical_size());
+    augmented.view(0, 0, vertical_size(), horizontal_size()) = *this;
     for (size_t i = 0; i < vertical_size(); i++) {
-      copied_data[i].push_back(b[i]);
+      augmented[i][horizontal_size()] = b[i];
     }
+    augmented.make_gauss();
 
-    std::vector<U> result = Matrix(copied_data).gauss().data_;
+    std::vector<U> result(vertical_size());
     for (size_t i = 0; i < vertical_size(); i++) {
-      result.push_back(copied_data[i].back());
+      result[i] = augmented[i][horizontal_size()];
+    }
+    return result;
+  }
+
+  QR<T> qr(bool column_pivoting = false) const {
+    return QR<T>(*this, column_pivoting);
+  }
+
+  // Решение переопределённой системы в смысле наименьших квадратов; высокие матрицы раскладываются по TSQR.
+  // Для матрицы неполного ранга - базисное решение QR с выбором столбцов
+  std::vector<T> least_squares(const std::vector<T> &b) const {
+    std::vector<T> result;
+    if (vertical_size() >= 4 * horizontal_size()) {
+      result = tsqr_least_squares(*this, b);
+    }
+    if (result.empty()) {
+      result = QR<T>(*this, true).least_squares(b);
     }
     return result;
   }
 
   Matrix &resize_vertically(int new_size) {
-    data_.resize(new_size, std::vector<T>(horizontal_size()));
+    data_.resize(static_cast<size_t>(new_size) * stride_);
+    vertical_size_ = new_size;
+    return *this;
   }
 
   Matrix &resize_horizontally(int new_size) {
-    for (auto line : data_) {
-      line.resize(new_size);
+    Matrix result(new_size, vertical_size());
+    size_t common_size = std::min(horizontal_size(), result.horizontal_size());
+    for (size_t i = 0; i < vertical_size(); i++) {
+      std::move(line(i), line(i) + common_size, result.line(i));
     }
+    *this = std::move(result);
+    return *this;
   }
 
   Matrix &cut(int top, int left, int bottom, int right) {
-    auto new_data = std::vector<std::vector<T>>(bottom - top);
+    // Блок сдвигается только к началу буфера, поэтому можно переносить элементы на месте
+    size_t new_horizontal_size = right - left;
     for (int i = top; i < bottom; i++) {
-      new_data[i - top] = std::vector<T>(right - left);
-      for (int j = left; j < right; j++) {
-        new_data[i - top][j - left] = data_[i][j];
-      }
+      std::move(line(i) + left, line(i) + right, data_.begin() + (i - top) * new_horizontal_size);
     }
-    data_ = new_data;
+    vertical_size_ = bottom - top;
+    horizontal_size_ = new_horizontal_size;
+    stride_ = new_horizontal_size;
+    data_.resize(vertical_size_ * stride_);
     return *this;
   }
 
@@ -275,68 +615,184 @@ class Matrix {
     return cut(0, 0, vertical_size, horizontal_size);
   }
 
-  Matrix cutted(int top, int left, int bottom, int right) const {
-    Matrix result = *this;
-    result.cut(top, left, bottom, right);
+  Matrix cutted(int top, int left, int bottom, int right) const & {
+    Matrix result(right - left, bottom - top);
+    for (int i = top; i < bottom; i++) {
+      std::copy(line(i) + left, line(i) + right, result.line(i - top));
+    }
     return result;
   }
 
-  Matrix cutted(int vertical_size, int horizontal_size) const {
-    Matrix result = *this;
-    result.cut(vertical_size, horizontal_size);
-    return result;
+  Matrix cutted(int top, int left, int bottom, int right) && {
+    cut(top, left, bottom, right);
+    return std::move(*this);
+  }
+
+  Matrix cutted(int vertical_size, int horizontal_size) const & {
+    return cutted(0, 0, vertical_size, horizontal_size);
+  }
+
+  Matrix cutted(int vertical_size, int horizontal_size) && {
+    return std::move(*this).cutted(0, 0, vertical_size, horizontal_size);
   }
 
   Matrix &operator|=(const Matrix &other) {
-    if (other.vertical_size() > vertical_size()) {
-      resize_vertically(other.vertical_size());
+    size_t new_vertical_size = std::max(vertical_size(), other.vertical_size());
+    Matrix result(horizontal_size() + other.horizontal_size(), new_vertical_size);
+    for (size_t i = 0; i < vertical_size(); i++) {
+      std::move(line(i), line(i) + horizontal_size(), result.line(i));
     }
-    for (int i = 0; i < vertical_size(); i++) {
-      for (auto item : other[i]) {
-        data_[i].push_back(item);
-      }
+    for (size_t i = 0; i < other.vertical_size(); i++) {
+      std::copy(other.line(i), other.line(i) + other.horizontal_size(), result.line(i) + horizontal_size());
     }
+    *this = std::move(result);
+    return *this;
   }
 
-  Matrix operator|(const Matrix &other) const {
+  Matrix operator|(const Matrix &other) const & {
     Matrix result = *this;
     result |= other;
     return result;
   }
 
-  bool empty() {
+  Matrix operator|(const Matrix &other) && {
+    *this |= other;
+    return std::move(*this);
+  }
+
+  bool empty() const {
     return data_.empty();
   }
 
+  // Через блочное LU-разложение: без приписанной единичной матрицы, и почти вся работа - умножения блоков.
+  // Вырожденная матрица становится пустой
   Matrix &inverse() {
-    Matrix result = (*this) | Identity<T>(vertical_size());
-    result.make_gauss();
-    if (result[vertical_size() - 1][vertical_size() - 1] == T(0)) {
-      data_.clear();
-    } else {
-      data_ = result.cut(0, vertical_size(), vertical_size(), vertical_size() * 2).data_;
-    }
+    *this = LU<T>(std::move(*this)).inverse();
     return *this;
   }
 
-  Matrix operator-() const {
-    Matrix tmp = *this;
-    for (auto &line : tmp.data_) {
-      for (auto &item : line) {
-        item = -item;
+  Matrix inversed() const & {
+    Matrix result = *this;
+    result.inverse();
+    return result;
+  }
+
+  Matrix inversed() && {
+    inverse();
+    return std::move(*this);
+  }
+
+  // A^power бинарным возведением от старшего бита: умножается только на исходную A, а результат и черновик
+  // меняются ролями, так что новые матрицы на шагах не создаются. Память при этом всё же может выделяться:
+  // умножение по Штрассену заводит временные блоки, а раздача работы потокам - свои задания; обычное
+  // умножение берёт буферы упаковки у потока. Отрицательная степень - степень обратной матрицы;
+  // вырожденная или неквадратная матрица становится пустой
+  Matrix &pow(long long power) {
+    if (vertical_size() != horizontal_size()) {
+      *this = Matrix();
+      return *this;
+    }
+    unsigned long long exponent = power < 0 ? 0ull - static_cast<unsigned long long>(power) : power;
+    if (power < 0) {
+      inverse();
+    }
+    size_t n = vertical_size();
+    if (exponent == 0 || empty()) {
+      view().fill(T(0));
+      for (size_t i = 0; i < n; i++) {
+        (*this)[i][i] = T(1);
       }
+      return *this;
     }
-    return tmp;
+    Matrix result = *this;
+    Matrix scratch(n, n);
+    int bit = 63 - __builtin_clzll(exponent);
+    while (bit-- > 0) {
+      multiply(scratch.view(), result.view(), result.view());
+      std::swap(result, scratch);
+      if ((exponent >> bit) & 1) {
+        multiply(scratch.view(), result.view(), view());
+        std::swap(result, scratch);
+      }
+    }
+    *this = std::move(result);
+    return *this;
   }
 
-  Matrix inversed() const {
+  Matrix powered(long long power) const & {
     Matrix result = *this;
-    result.inverse();
+    result.pow(power);
     return result;
   }
 
-  // Ожидается, что эту функцию не будут запускать от матрицы многчленов
+  Matrix powered(long long power) && {
+    pow(power);
+    return std::move(*this);
+  }
+
+  // A^power по теореме Гамильтона-Кэли: x^power берётся по модулю характеристического многочлена за
+  // O(n^2 log power), и остаток степени меньше n вычисляется от A схемой Патерсона-Стокмейера примерно
+  // за 2 sqrt(n) умножений вместо 2 log2(power). Выгодно для огромных степеней небольших матриц, например
+  // для линейных рекуррент. Коэффициенты многочлена быстро теряют точность, поэтому метод предназначен
+  // для точных типов вроде ModInt
+  Matrix powered_by_characteristic_polynomial(unsigned long long power) const {
+    size_t n = vertical_size();
+    if (n != horizontal_size()) {
+      return Matrix();
+    }
+    Polynomial<T> modulus = characteristic_polynomial();
+    Polynomial<T> remainder = T(1);
+    Polynomial<T> base = Polynomial<T>({T(0), T(1)}) % modulus;
+    for (; power != 0; power >>= 1) {
+      if (power & 1) {
+        remainder = remainder * base % modulus;
+      }
+      base = base * base % modulus;
+    }
+
+    size_t step = 1;
+    while (step * step < n) {
+      step++;
+    }
+    std::vector<Matrix> powers(step + 1);
+    powers[0] = Matrix(n, n);
+    for (size_t i = 0; i < n; i++) {
+      powers[0][i][i] = T(1);
+    }
+    for (size_t i = 1; i <= step; i++) {
+      powers[i] = powers[i - 1] * (*this);
+    }
+    // Горнер по блокам из step коэффициентов: result = result * A^step + sum r_(block * step + i) A^i
+    Matrix result(n, n);
+    Matrix scratch(n, n);
+    size_t blocks = (n + step - 1) / step;
+    for (size_t block = blocks; block-- > 0;) {
+      if (block + 1 != blocks) {
+        multiply(scratch.view(), result.view(), powers[step].view());
+        std::swap(result, scratch);
+      }
+      for (size_t i = 0; i < step && block * step + i < n; i++) {
+        T coefficient = remainder[block * step + i];
+        if (coefficient != T(0)) {
+          result += powers[i] * coefficient;
+        }
+      }
+    }
+    return result;
+  }
+
+  // det(lambda * E - A) за O(n^3) через форму Хессенберга для чисел с плавающей точкой
+  // и за O(n^4) алгоритмом Берковица без делений для целых и точных типов
   Polynomial<T> characteristic_polynomial() const {
+    if constexpr (std::is_floating_point<T>::value) {
+      return hessenberg_characteristic_polynomial();
+    } else {
+      return berkowitz_characteristic_polynomial();
+    }
+  }
+
+  // Ожидается, что эту функцию не будут запускать от матрицы многчленов
+  Polynomial<T> slow_characteristic_polynomial() const {
     // result = lambda * E - A
     Matrix<Polynomial<T>> result(vertical_size(), horizontal_size());
     for (int i = 0; i < vertical_size(); i++) {
@@ -356,14 +812,66 @@ class Matrix {
   }
 };
 
+// Поэлементные операции с временной матрицей считаются прямо в её буфере, а не в новой матрице.
+// Так цепочки вида a * b + c - d выделяют память только под произведение
+template<typename T, typename R>
+Matrix<T> operator+(Matrix<T> &&lhs, const MatrixExpression<R> &rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template<typename L, typename T>
+Matrix<T> operator+(const MatrixExpression<L> &lhs, Matrix<T> &&rhs) {
+  rhs += lhs;
+  return std::move(rhs);
+}
+
+template<typename T>
+Matrix<T> operator+(Matrix<T> &&lhs, Matrix<T> &&rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template<typename T, typename R>
+Matrix<T> operator-(Matrix<T> &&lhs, const MatrixExpression<R> &rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+template<typename L, typename T>
+Matrix<T> operator-(const MatrixExpression<L> &lhs, Matrix<T> &&rhs) {
+  rhs.view() = lhs.self() - rhs.view();
+  return std::move(rhs);
+}
+
+template<typename T>
+Matrix<T> operator-(Matrix<T> &&lhs, Matrix<T> &&rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+template<typename T>
+Matrix<T> operator-(Matrix<T> &&operand) {
+  operand.view() = -operand.view();
+  return std::move(operand);
+}
+
+template<typename T, typename S, typename = std::enable_if_t<!is_matrix_expression<S>::value>>
+Matrix<T> operator*(Matrix<T> &&operand, const S &scalar) {
+  operand *= scalar;
+  return std::move(operand);
+}
+
 template<typename T>
 Matrix<T> Identity(int size) {
-  std::vector<std::vector<T>> data(static_cast<unsigned int>(size));
+  Matrix<T> result(size, size);
   for (int i = 0; i < size; i++) {
-    data[i].resize(size, T(0));
-    data[i][i] = T(1);
+    result[i][i] = T(1);
   }
-  return Matrix<T>(data);
+  return result;
 }
 
+#include "LU.h"
+#include "QR.h"
+
 #endif //LINEARALG_MATRIX_H
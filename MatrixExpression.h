@@ -0,0 +1,244 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_MATRIXEXPRESSION_H
+#define LINEARALG_MATRIXEXPRESSION_H
+
+#include <cstddef>
+#include <type_traits>
+
+template<typename T>
+class Matrix;
+
+template<typename T>
+class MatrixView;
+
+template<typename T>
+class TransposedMatrixView;
+
+// Поэлементные операции над матрицами не считаются сразу, а собираются в дерево выражения.
+// Выражение вычисляется за один проход при присваивании в Matrix, поэтому цепочка вроде
+// A + B * 2 - C создаёт ровно одну новую матрицу.
+// Выражение хранит ссылки на матрицы-операнды, так что сохранять его в auto нельзя,
+// если операнды - временные объекты.
+// Запись в блок, который выражение читает не только по тем же индексам (например, S = S^T или
+// сдвинутый блок той же матрицы), идёт через временную матрицу, это проверяет aliases.
+template<typename E>
+class MatrixExpression {
+ public:
+  const E &self() const {
+    return static_cast<const E &>(*this);
+  }
+
+  size_t vertical_size() const {
+    return self().vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return self().horizontal_size();
+  }
+
+  decltype(auto) operator()(size_t i, size_t j) const {
+    return self()(i, j);
+  }
+
+  // Может ли запись в destination по индексам (i, j) изменить элемент, который выражение читает по другим индексам
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return self().aliases(destination);
+  }
+
+  auto eval() const {
+    return Matrix<typename E::value_type>(*this);
+  }
+};
+
+template<typename T>
+struct is_matrix_expression : std::is_base_of<MatrixExpression<T>, T> {
+};
+
+// Матрицы хранятся в узлах по ссылке, промежуточные узлы - по значению
+template<typename E>
+struct ExpressionOperand {
+  using type = const E;
+};
+
+template<typename T>
+struct ExpressionOperand<Matrix<T>> {
+  using type = const Matrix<T> &;
+};
+
+template<typename L, typename R>
+class MatrixSum : public MatrixExpression<MatrixSum<L, R>> {
+ public:
+  using value_type = typename L::value_type;
+
+  MatrixSum(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {
+  }
+
+  size_t vertical_size() const {
+    return lhs_.vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return lhs_.horizontal_size();
+  }
+
+  value_type operator()(size_t i, size_t j) const {
+    return lhs_(i, j) + rhs_(i, j);
+  }
+
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return lhs_.aliases(destination) || rhs_.aliases(destination);
+  }
+
+ private:
+  typename ExpressionOperand<L>::type lhs_;
+  typename ExpressionOperand<R>::type rhs_;
+};
+
+template<typename L, typename R>
+class MatrixDifference : public MatrixExpression<MatrixDifference<L, R>> {
+ public:
+  using value_type = typename L::value_type;
+
+  MatrixDifference(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {
+  }
+
+  size_t vertical_size() const {
+    return lhs_.vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return lhs_.horizontal_size();
+  }
+
+  value_type operator()(size_t i, size_t j) const {
+    return lhs_(i, j) - rhs_(i, j);
+  }
+
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return lhs_.aliases(destination) || rhs_.aliases(destination);
+  }
+
+ private:
+  typename ExpressionOperand<L>::type lhs_;
+  typename ExpressionOperand<R>::type rhs_;
+};
+
+template<typename E>
+class MatrixNegation : public MatrixExpression<MatrixNegation<E>> {
+ public:
+  using value_type = typename E::value_type;
+
+  explicit MatrixNegation(const E &operand) : operand_(operand) {
+  }
+
+  size_t vertical_size() const {
+    return operand_.vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return operand_.horizontal_size();
+  }
+
+  value_type operator()(size_t i, size_t j) const {
+    return -operand_(i, j);
+  }
+
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return operand_.aliases(destination);
+  }
+
+ private:
+  typename ExpressionOperand<E>::type operand_;
+};
+
+template<typename E, typename S>
+class MatrixScaled : public MatrixExpression<MatrixScaled<E, S>> {
+ public:
+  using value_type = typename E::value_type;
+
+  MatrixScaled(const E &operand, const S &scalar) : operand_(operand), scalar_(scalar) {
+  }
+
+  size_t vertical_size() const {
+    return operand_.vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return operand_.horizontal_size();
+  }
+
+  value_type operator()(size_t i, size_t j) const {
+    value_type result = operand_(i, j);
+    result *= scalar_;
+    return result;
+  }
+
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return operand_.aliases(destination);
+  }
+
+ private:
+  typename ExpressionOperand<E>::type operand_;
+  S scalar_;
+};
+
+template<typename L, typename R>
+MatrixSum<L, R> operator+(const MatrixExpression<L> &lhs, const MatrixExpression<R> &rhs) {
+  return MatrixSum<L, R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+MatrixDifference<L, R> operator-(const MatrixExpression<L> &lhs, const MatrixExpression<R> &rhs) {
+  return MatrixDifference<L, R>(lhs.self(), rhs.self());
+}
+
+template<typename E>
+MatrixNegation<E> operator-(const MatrixExpression<E> &operand) {
+  return MatrixNegation<E>(operand.self());
+}
+
+template<typename E, typename S, typename = std::enable_if_t<!is_matrix_expression<S>::value>>
+MatrixScaled<E, S> operator*(const MatrixExpression<E> &operand, const S &scalar) {
+  return MatrixScaled<E, S>(operand.self(), scalar);
+}
+
+// Вычисляет выражение; матрицы и взгляды на них возвращаются без копирования элементов
+template<typename T>
+const Matrix<T> &evaluate(const Matrix<T> &matrix) {
+  return matrix;
+}
+
+template<typename T>
+MatrixView<T> evaluate(const MatrixView<T> &view) {
+  return view;
+}
+
+template<typename T>
+TransposedMatrixView<T> evaluate(const TransposedMatrixView<T> &view) {
+  return view;
+}
+
+template<typename E>
+Matrix<typename E::value_type> evaluate(const MatrixExpression<E> &expression) {
+  return Matrix<typename E::value_type>(expression);
+}
+
+// Матричное произведение не поэлементное, поэтому операнды-выражения сначала вычисляются
+template<typename L, typename R>
+Matrix<typename L::value_type> operator*(const MatrixExpression<L> &lhs, const MatrixExpression<R> &rhs) {
+  const auto &left = evaluate(lhs.self());
+  const auto &right = evaluate(rhs.self());
+  Matrix<typename L::value_type> result(right.horizontal_size(), left.vertical_size());
+  multiply(result.view(), left.view(), right.view());
+  return result;
+}
+
+#endif //LINEARALG_MATRIXEXPRESSION_H
@@ -0,0 +1,477 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_MATRIXFILE_H
+#define LINEARALG_MATRIXFILE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Matrix.h"
+
+// Двоичный формат матрицы: заголовок MatrixFileHeader, затем с отступа data_offset строки подряд
+// с шагом stride элементов. Отступ кратен размеру страницы, поэтому данные отображаются в память как есть,
+// и MatrixView смотрит прямо в файл без копирования и разбора. Числа хранятся в порядке байтов машины,
+// byte_order позволяет заметить файл с другим порядком.
+constexpr char MATRIX_FILE_MAGIC[8] = {'L', 'I', 'N', 'A', 'L', 'G', 'M', 'F'};
+constexpr uint32_t MATRIX_FILE_VERSION = 1;
+constexpr uint32_t MATRIX_FILE_BYTE_ORDER = 0x01020304;
+constexpr size_t MATRIX_FILE_ALIGNMENT = 4096;
+
+enum class MatrixFileType : uint32_t {
+  INT32 = 1,
+  INT64 = 2,
+  FLOAT32 = 3,
+  FLOAT64 = 4
+};
+
+static_assert(sizeof(int) == 4 && sizeof(long long) == 8, "INT32 and INT64 are stored as int and long long");
+
+template<typename T>
+struct MatrixFileTypeOf;
+
+template<>
+struct MatrixFileTypeOf<int> {
+  static constexpr MatrixFileType value = MatrixFileType::INT32;
+};
+
+template<>
+struct MatrixFileTypeOf<long long> {
+  static constexpr MatrixFileType value = MatrixFileType::INT64;
+};
+
+template<>
+struct MatrixFileTypeOf<float> {
+  static constexpr MatrixFileType value = MatrixFileType::FLOAT32;
+};
+
+template<>
+struct MatrixFileTypeOf<double> {
+  static constexpr MatrixFileType value = MatrixFileType::FLOAT64;
+};
+
+struct MatrixFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t type;
+  uint32_t reserved;
+  uint64_t vertical_size;
+  uint64_t horizontal_size;
+  uint64_t stride;
+  uint64_t data_offset;
+};
+
+// Матрица из файла, отображённого в память. Открытая для чтения даёт только view() const,
+// созданная или открытая для записи - ещё и writable_view(), изменения попадают в файл.
+// При ошибке открытия объект пустой. Только для POSIX.
+template<typename T>
+class MappedMatrix {
+ public:
+  MappedMatrix() {
+
+  }
+
+  static MappedMatrix open(const std::string &path, bool writable = false) {
+    MappedMatrix result;
+    int descriptor = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (descriptor < 0) {
+      return result;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(MatrixFileHeader)) {
+      close(descriptor);
+      return result;
+    }
+    size_t file_size = status.st_size;
+    void *mapping = mmap(nullptr, file_size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                         descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED) {
+      return result;
+    }
+    result.mapping_ = mapping;
+    result.mapped_size_ = file_size;
+    result.writable_ = writable;
+
+    MatrixFileHeader header;
+    std::memcpy(&header, mapping, sizeof(header));
+    if (std::memcmp(header.magic, MATRIX_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != MATRIX_FILE_VERSION || header.byte_order != MATRIX_FILE_BYTE_ORDER ||
+        header.type != static_cast<uint32_t>(MatrixFileTypeOf<T>::value) ||
+        header.stride < header.horizontal_size || header.data_offset % alignof(T) != 0 ||
+        !fits_in_file(header, file_size)) {
+      return MappedMatrix();
+    }
+    result.data_ = reinterpret_cast<T *>(static_cast<char *>(mapping) + header.data_offset);
+    result.vertical_size_ = header.vertical_size;
+    result.horizontal_size_ = header.horizontal_size;
+    result.stride_ = header.stride;
+    return result;
+  }
+
+  // Создаёт файл с нулевой матрицей (файл растягивается без записи, так что это быстро) и открывает его для записи
+  static MappedMatrix create(const std::string &path, size_t vertical_size, size_t horizontal_size) {
+    MatrixFileHeader header = {};
+    std::memcpy(header.magic, MATRIX_FILE_MAGIC, sizeof(header.magic));
+    header.version = MATRIX_FILE_VERSION;
+    header.byte_order = MATRIX_FILE_BYTE_ORDER;
+    header.type = static_cast<uint32_t>(MatrixFileTypeOf<T>::value);
+    header.vertical_size = vertical_size;
+    header.horizontal_size = horizontal_size;
+    header.stride = horizontal_size;
+    header.data_offset = MATRIX_FILE_ALIGNMENT;
+
+    int descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0) {
+      return MappedMatrix();
+    }
+    size_t file_size = header.data_offset + vertical_size * horizontal_size * sizeof(T);
+    bool written = ftruncate(descriptor, file_size) == 0 &&
+                   pwrite(descriptor, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+    close(descriptor);
+    if (!written) {
+      return MappedMatrix();
+    }
+    return open(path, true);
+  }
+
+  MappedMatrix(const MappedMatrix &other) = delete;
+
+  MappedMatrix &operator=(const MappedMatrix &other) = delete;
+
+  MappedMatrix(MappedMatrix &&other) noexcept {
+    *this = std::move(other);
+  }
+
+  MappedMatrix &operator=(MappedMatrix &&other) noexcept {
+    if (this != &other) {
+      unmap();
+      std::swap(mapping_, other.mapping_);
+      std::swap(mapped_size_, other.mapped_size_);
+      std::swap(writable_, other.writable_);
+      std::swap(data_, other.data_);
+      std::swap(vertical_size_, other.vertical_size_);
+      std::swap(horizontal_size_, other.horizontal_size_);
+      std::swap(stride_, other.stride_);
+    }
+    return *this;
+  }
+
+  ~MappedMatrix() {
+    unmap();
+  }
+
+  bool empty() const {
+    return mapping_ == nullptr;
+  }
+
+  bool writable() const {
+    return writable_;
+  }
+
+  size_t vertical_size() const {
+    return vertical_size_;
+  }
+
+  size_t horizontal_size() const {
+    return horizontal_size_;
+  }
+
+  std::pair<size_t, size_t> size() const {
+    return {vertical_size(), horizontal_size()};
+  }
+
+  MatrixView<const T> view() const {
+    return MatrixView<const T>(data_, vertical_size_, horizontal_size_, stride_);
+  }
+
+  MatrixView<const T> view(size_t top, size_t left, size_t bottom, size_t right) const {
+    return view().view(top, left, bottom, right);
+  }
+
+  // Для открытой только на чтение матрицы возвращает пустой взгляд
+  MatrixView<T> writable_view() const {
+    if (!writable_) {
+      return MatrixView<T>();
+    }
+    return MatrixView<T>(data_, vertical_size_, horizontal_size_, stride_);
+  }
+
+  MatrixView<T> writable_view(size_t top, size_t left, size_t bottom, size_t right) const {
+    return writable_view().view(top, left, bottom, right);
+  }
+
+  // Записывает изменения на диск
+  void flush() const {
+    if (writable_) {
+      msync(mapping_, mapped_size_, MS_SYNC);
+    }
+  }
+
+  // Отдаёт системе страницы строк [top, bottom): изменённые сначала записываются, а при следующем
+  // обращении страницы снова читаются из файла. Так потоковые алгоритмы не держат в памяти весь файл
+  void release(size_t top, size_t bottom) const {
+    if (empty() || top >= bottom) {
+      return;
+    }
+    size_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = reinterpret_cast<uintptr_t>(data_ + top * stride_);
+    uintptr_t end = reinterpret_cast<uintptr_t>(data_ + bottom * stride_);
+    begin -= begin % page;
+    void *first = reinterpret_cast<void *>(begin);
+    if (writable_) {
+      msync(first, end - begin, MS_SYNC);
+    }
+    madvise(first, end - begin, MADV_DONTNEED);
+  }
+
+ private:
+  void *mapping_ = nullptr;
+  size_t mapped_size_ = 0;
+  bool writable_ = false;
+  T *data_ = nullptr;
+  size_t vertical_size_ = 0;
+  size_t horizontal_size_ = 0;
+  size_t stride_ = 0;
+
+  // Размеры в заголовке не доверенные, поэтому data_offset + vertical_size * stride * sizeof(T) <= file_size
+  // проверяется делением, без произведений, которые могут переполниться
+  static bool fits_in_file(const MatrixFileHeader &header, size_t file_size) {
+    if (header.data_offset < sizeof(MatrixFileHeader) || header.data_offset > file_size) {
+      return false;
+    }
+    if (header.vertical_size == 0) {
+      return true;
+    }
+    return header.stride != 0 && header.vertical_size <= (file_size - header.data_offset) / sizeof(T) / header.stride;
+  }
+
+  void unmap() {
+    if (mapping_ != nullptr) {
+      munmap(mapping_, mapped_size_);
+      mapping_ = nullptr;
+    }
+  }
+};
+
+template<typename T>
+bool write_matrix_file(const std::string &path, typename MatrixView<T>::const_view matrix) {
+  MappedMatrix<T> file = MappedMatrix<T>::create(path, matrix.vertical_size(), matrix.horizontal_size());
+  if (file.empty()) {
+    return false;
+  }
+  file.writable_view() = matrix;
+  file.flush();
+  return true;
+}
+
+template<typename T>
+bool write_matrix_file(const std::string &path, const Matrix<T> &matrix) {
+  return write_matrix_file<T>(path, matrix.view());
+}
+
+// Читает матрицу целиком в память. При ошибке возвращает пустую матрицу
+template<typename T>
+Matrix<T> read_matrix_file(const std::string &path) {
+  MappedMatrix<T> file = MappedMatrix<T>::open(path);
+  if (file.empty()) {
+    return Matrix<T>();
+  }
+  return Matrix<T>(file.view());
+}
+
+// C = A * B для матриц в файлах, которые не обязаны помещаться в память. C считается блоками tile x tile,
+// в каждый из которых накапливаются произведения полос A и B по tile строк и столбцов. Одновременно нужны
+// полоса A из tile строк, блок B и блок C, прочитанные страницы отдаются системе после каждой полосы A.
+// Возвращает false, если файлы не открываются или размеры не согласованы
+template<typename T>
+bool multiply_matrix_files(const std::string &result_path, const std::string &lhs_path,
+                           const std::string &rhs_path, size_t tile = 2048) {
+  MappedMatrix<T> a = MappedMatrix<T>::open(lhs_path);
+  MappedMatrix<T> b = MappedMatrix<T>::open(rhs_path);
+  if (a.empty() || b.empty() || a.horizontal_size() != b.vertical_size()) {
+    return false;
+  }
+  size_t m = a.vertical_size();
+  size_t n = b.horizontal_size();
+  size_t k = a.horizontal_size();
+  MappedMatrix<T> c = MappedMatrix<T>::create(result_path, m, n);
+  if (c.empty()) {
+    return false;
+  }
+  for (size_t top = 0; top < m; top += tile) {
+    size_t bottom = std::min(m, top + tile);
+    for (size_t left = 0; left < n; left += tile) {
+      size_t right = std::min(n, left + tile);
+      MatrixView<T> block = c.writable_view(top, left, bottom, right);
+      for (size_t middle = 0; middle < k; middle += tile) {
+        size_t end = std::min(k, middle + tile);
+        multiply_add<T>(block, a.view(top, middle, bottom, end), b.view(middle, left, end, right));
+      }
+    }
+    a.release(top, bottom);
+    c.release(top, bottom);
+    b.release(0, k);
+  }
+  c.flush();
+  return true;
+}
+
+// LU-разложение на месте для квадратной матрицы в файле, которая не помещается в память.
+// Разложение левостороннее по полосам столбцов ширины panel_width: очередная полоса читается в память,
+// к ней применяются все предыдущие полосы (треугольное решение и умножение блоков), затем она раскладывается
+// с выбором главного элемента и записывается обратно. В памяти одновременно две полосы n x panel_width.
+// После разложения файл хранит L и U так же, как LU::factors().
+template<typename T>
+class MappedLU {
+ public:
+  explicit MappedLU(const std::string &path, size_t panel_width = 256)
+          : file_(MappedMatrix<T>::open(path, true)) {
+    if (file_.empty() || file_.vertical_size() != file_.horizontal_size()) {
+      singular_ = true;
+      file_ = MappedMatrix<T>();
+      return;
+    }
+    factorize(panel_width);
+  }
+
+  size_t size() const {
+    return file_.vertical_size();
+  }
+
+  bool singular() const {
+    return singular_;
+  }
+
+  // Строка i матрицы PA - это строка permutation()[i] исходной матрицы
+  const std::vector<size_t> &permutation() const {
+    return permutation_;
+  }
+
+  T determinant() const {
+    if (singular_) {
+      return T(0);
+    }
+    T result = T(sign_);
+    for (size_t i = 0; i < size(); i++) {
+      result *= file_.view()(i, i);
+    }
+    return result;
+  }
+
+  // Прямой и обратный ход читают файл строками подряд. Для вырожденной матрицы возвращает пустой вектор
+  std::vector<T> solve(const std::vector<T> &b) const {
+    if (singular_) {
+      return {};
+    }
+    MatrixView<const T> factors = file_.view();
+    std::vector<T> result(size());
+    for (size_t i = 0; i < size(); i++) {
+      result[i] = b[permutation_[i]];
+    }
+    for (size_t i = 0; i < size(); i++) {
+      const T *line = factors[i];
+      for (size_t j = 0; j < i; j++) {
+        result[i] -= line[j] * result[j];
+      }
+    }
+    for (size_t i = size(); i-- > 0;) {
+      const T *line = factors[i];
+      for (size_t j = i + 1; j < size(); j++) {
+        result[i] -= line[j] * result[j];
+      }
+      result[i] /= line[i];
+    }
+    file_.release(0, size());
+    return result;
+  }
+
+ private:
+  MappedMatrix<T> file_;
+  std::vector<size_t> permutation_;
+  int sign_ = 1;
+  bool singular_ = false;
+
+  void factorize(size_t panel_width) {
+    size_t n = size();
+    MatrixView<T> factors = file_.writable_view();
+    // На шаге k строка k поменялась местами со строкой pivots[k]
+    std::vector<size_t> pivots(n);
+    auto apply_pivots = [&](MatrixView<T> panel, size_t first_step, size_t last_step, size_t top) {
+      for (size_t k = first_step; k < last_step; k++) {
+        if (pivots[k] != k) {
+          panel.swap_lines(k - top, pivots[k] - top);
+        }
+      }
+    };
+
+    for (size_t column = 0; column < n; column += panel_width) {
+      size_t end = std::min(n, column + panel_width);
+      size_t width = end - column;
+      Matrix<T> panel(factors.view(0, column, n, end));
+      apply_pivots(panel.view(), 0, column, 0);
+
+      for (size_t previous = 0; previous < column; previous += panel_width) {
+        size_t previous_end = previous + panel_width;
+        Matrix<T> lower(factors.view(previous, previous, n, previous_end));
+        apply_pivots(lower.view(), previous_end, column, previous);
+        MatrixView<T> upper = panel.view(previous, 0, previous_end, width);
+        solve_unit_lower<T>(lower.view(0, 0, panel_width, panel_width), upper);
+        multiply_subtract<T>(panel.view(previous_end, 0, n, width), lower.view(panel_width, 0, n - previous, panel_width),
+                             upper);
+      }
+
+      for (size_t k = column; k < end; k++) {
+        size_t local = k - column;
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; i++) {
+          if (my_abs(panel[i][local]) > my_abs(panel[pivot][local])) {
+            pivot = i;
+          }
+        }
+        pivots[k] = pivot;
+        if (panel[pivot][local] == T(0)) {
+          singular_ = true;
+          continue;
+        }
+        if (pivot != k) {
+          panel.view().swap_lines(pivot, k);
+          sign_ = -sign_;
+        }
+        const T *pivot_line = panel[k];
+        for (size_t i = k + 1; i < n; i++) {
+          T *line = panel[i];
+          line[local] /= pivot_line[local];
+          vector_sub_scaled(width - local - 1, line[local], pivot_line + local + 1, line + local + 1);
+        }
+      }
+
+      factors.view(0, column, n, end) = panel.view();
+      file_.release(0, n);
+    }
+
+    // Перестановки поздних полос применяются к уже записанным полосам L
+    for (size_t column = 0; column < n; column += panel_width) {
+      size_t end = std::min(n, column + panel_width);
+      apply_pivots(factors.view(0, column, n, end), end, n, 0);
+      file_.release(0, n);
+    }
+    permutation_.resize(n);
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+    for (size_t k = 0; k < n; k++) {
+      std::swap(permutation_[k], permutation_[pivots[k]]);
+    }
+  }
+};
+
+#endif //LINEARALG_MATRIXFILE_H
@@ -0,0 +1,493 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_MATRIXVIEW_H
+#define LINEARALG_MATRIXVIEW_H
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "Gemm.h"
+#include "MatrixExpression.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include "Utils.h"
+
+template<typename T>
+class TransposedMatrixView;
+
+// Невладеющий взгляд на прямоугольный блок построчно хранящейся матрицы: указатель на левый верхний
+// элемент, размеры и шаг между строками. Копирование взгляда копирует только сам взгляд, а присваивание
+// в него записывает элементы в блок, как и у ссылки. Для MatrixView<const T> доступно только чтение.
+template<typename T>
+class MatrixView : public MatrixExpression<MatrixView<T>> {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using const_view = MatrixView<const value_type>;
+
+  MatrixView() {
+
+  }
+
+  MatrixView(T *data, size_t vertical_size, size_t horizontal_size, size_t stride)
+          : data_(data), vertical_size_(vertical_size), horizontal_size_(horizontal_size), stride_(stride) {
+  }
+
+  MatrixView(const MatrixView &other) = default;
+
+  template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+  MatrixView(const MatrixView<U> &other)
+          : MatrixView(other.data(), other.vertical_size(), other.horizontal_size(), other.stride()) {
+  }
+
+  size_t vertical_size() const {
+    return vertical_size_;
+  }
+
+  size_t horizontal_size() const {
+    return horizontal_size_;
+  }
+
+  std::pair<size_t, size_t> size() const {
+    return {vertical_size(), horizontal_size()};
+  }
+
+  size_t stride() const {
+    return stride_;
+  }
+
+  T *data() const {
+    return data_;
+  }
+
+  bool empty() const {
+    return vertical_size_ == 0 || horizontal_size_ == 0;
+  }
+
+  T *operator[](size_t position) const {
+    return data_ + position * stride_;
+  }
+
+  T &operator()(size_t i, size_t j) const {
+    return data_[i * stride_ + j];
+  }
+
+  MatrixView view() const {
+    return *this;
+  }
+
+  TransposedMatrixView<T> transposed() const;
+
+  // Пересекаются ли диапазоны памяти, которые занимают блоки; блоки могут быть и разных типов, поэтому
+  // сравниваются байтовые адреса. Проверка грубая: два непересекающихся столбцовых блока одной матрицы
+  // тоже считаются пересекающимися
+  template<typename U>
+  bool overlaps(const MatrixView<U> &other) const {
+    if (empty() || other.empty()) {
+      return false;
+    }
+    const char *begin = reinterpret_cast<const char *>(data_);
+    const char *end = reinterpret_cast<const char *>(data_ + (vertical_size_ - 1) * stride_ + horizontal_size_);
+    const char *other_begin = reinterpret_cast<const char *>(other.data());
+    const char *other_end = reinterpret_cast<const char *>(
+            other.data() + (other.vertical_size() - 1) * other.stride() + other.horizontal_size());
+    std::less<const char *> less;
+    return less(begin, other_end) && less(other_begin, end);
+  }
+
+  // Блок того же типа с тем же началом и шагом, что и destination, читается по тем же индексам,
+  // по которым идёт запись
+  template<typename U>
+  bool aliases(const MatrixView<U> &destination) const {
+    bool same_elements = std::is_same<value_type, typename MatrixView<U>::value_type>::value &&
+                         static_cast<const void *>(data_) == static_cast<const void *>(destination.data()) &&
+                         stride_ == destination.stride();
+    return !same_elements && overlaps(destination);
+  }
+
+  // Блок строк [top, bottom) и столбцов [left, right) внутри этого взгляда
+  MatrixView view(size_t top, size_t left, size_t bottom, size_t right) const {
+    return MatrixView((*this)[top] + left, bottom - top, right - left, stride_);
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const MatrixView &view) {
+    out << "(";
+    for (size_t i = 0; i < view.vertical_size(); i++) {
+      if (i != 0) {
+        out << ",\n";
+      }
+      out << "(";
+      for (size_t j = 0; j < view.horizontal_size(); j++) {
+        if (j != 0) {
+          out << ", ";
+        }
+        out << view(i, j);
+      }
+      out << ")";
+    }
+    out << ")";
+    return out;
+  }
+
+  const MatrixView &operator=(const MatrixView &other) const {
+    if (other.aliases(*this)) {
+      return *this = copy_of(other);
+    }
+    for_each_line([&](size_t i, T *line) {
+      std::copy(other[i], other[i] + horizontal_size_, line);
+    });
+    return *this;
+  }
+
+  // Поэлементное выражение читает (i, j) только перед записью в (i, j), так что этот же блок может в нём участвовать.
+  // Если выражение читает блок по другим индексам, оно сначала вычисляется во временную матрицу
+  template<typename E>
+  const MatrixView &operator=(const MatrixExpression<E> &expression) const {
+    if (expression.aliases(*this)) {
+      return *this = copy_of(expression);
+    }
+    for_each_line([&](size_t i, T *line) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        line[j] = expression(i, j);
+      }
+    });
+    return *this;
+  }
+
+  const MatrixView &operator+=(const_view other) const {
+    if (other.aliases(*this)) {
+      return *this += copy_of(other);
+    }
+    for_each_line([&](size_t i, T *line) {
+      vector_add(horizontal_size_, other[i], line);
+    });
+    return *this;
+  }
+
+  template<typename E>
+  const MatrixView &operator+=(const MatrixExpression<E> &expression) const {
+    if (expression.aliases(*this)) {
+      return *this += copy_of(expression);
+    }
+    for_each_line([&](size_t i, T *line) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        line[j] += expression(i, j);
+      }
+    });
+    return *this;
+  }
+
+  const MatrixView &operator-=(const_view other) const {
+    if (other.aliases(*this)) {
+      return *this -= copy_of(other);
+    }
+    for_each_line([&](size_t i, T *line) {
+      const value_type *other_line = other[i];
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        line[j] -= other_line[j];
+      }
+    });
+    return *this;
+  }
+
+  template<typename E>
+  const MatrixView &operator-=(const MatrixExpression<E> &expression) const {
+    if (expression.aliases(*this)) {
+      return *this -= copy_of(expression);
+    }
+    for_each_line([&](size_t i, T *line) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        line[j] -= expression(i, j);
+      }
+    });
+    return *this;
+  }
+
+  template<typename S, typename = std::enable_if_t<!is_matrix_expression<S>::value>>
+  const MatrixView &operator*=(const S &scalar) const {
+    for_each_line([&](size_t, T *line) {
+      if constexpr (std::is_floating_point<value_type>::value && std::is_arithmetic<S>::value) {
+        vector_scale(horizontal_size_, static_cast<value_type>(scalar), line);
+      } else {
+        vector_scale(horizontal_size_, scalar, line);
+      }
+    });
+    return *this;
+  }
+
+  void fill(const value_type &value) const {
+    for_each_line([&](size_t, T *line) {
+      std::fill(line, line + horizontal_size_, value);
+    });
+  }
+
+  void swap_lines(size_t first, size_t second) const {
+    if (first != second) {
+      std::swap_ranges((*this)[first], (*this)[first] + horizontal_size_, (*this)[second]);
+    }
+  }
+
+  // Приведение к улучшенному ступенчатому виду методом Гаусса-Жордана прямо в блоке
+  const MatrixView &make_gauss() const {
+    for (size_t column = 0, row = 0; row < vertical_size() && column < horizontal_size(); row++, column++) {
+      size_t max_element_row = row;
+      value_type coefficient = value_type(0);
+      while (coefficient == value_type(0) && column < horizontal_size()) {
+        for (size_t j = row + 1; j < vertical_size(); j++) {
+          if (my_abs((*this)(j, column)) > my_abs((*this)(max_element_row, column))) {
+            max_element_row = j;
+          }
+        }
+        coefficient = (*this)(max_element_row, column);
+        column++;
+      }
+      column--;
+      // Все оставшиеся столбцы ниже row нулевые - матрица уже приведена
+      if (coefficient == value_type(0)) {
+        break;
+      }
+      swap_lines(row, max_element_row);
+
+      T *pivot_line = (*this)[row];
+      for (size_t k = 0; k < horizontal_size(); k++) {
+        pivot_line[k] /= coefficient;
+      }
+      // Строки обновляются независимо, поэтому их можно раздать потокам без потери детерминированности
+      auto eliminate = [&](size_t first, size_t last) {
+        for (size_t j = first; j < last; j++) {
+          if (j == row) continue;
+          value_type current_coefficient = (*this)(j, column);
+          if (current_coefficient == value_type(0)) continue;
+          vector_sub_scaled(horizontal_size(), current_coefficient, pivot_line, (*this)[j]);
+        }
+      };
+      if (vertical_size() * horizontal_size() >= 1 << 15) {
+        parallel_for(0, vertical_size(), 16, eliminate);
+      } else {
+        eliminate(0, vertical_size());
+      }
+    }
+    return *this;
+  }
+
+  // Приведение к ступенчатому (не улучшенному) виду прямо в блоке: под ведущими элементами нули, строки
+  // не нормируются, строки выше ведущей не трогаются, и вычитание идёт только правее ведущего столбца.
+  // Столбцы без ведущего элемента пропускаются, исключение заканчивается, как только кончаются строки
+  // или столбцы. Для чисел с плавающей точкой элементы не больше max(m, n) min(m, n) eps |A| считаются нулями,
+  // где |A| = max_i sum_j |a_ij|: элемент проходит до min(m, n) шагов исключения, и на каждом погрешность
+  // растёт с суммой строки, а не с её наибольшим элементом. Встроенные целые делятся с отбрасыванием остатка,
+  // поэтому для них исключение идёт без дробей по Бареиссу: a_ij = (p a_ij - a_ic p_j) / p', где p и p' -
+  // текущий и предыдущий ведущие элементы. Деление здесь точное, элементы остаются минорами исходной матрицы,
+  // а произведения считаются в WideProduct, как в bareiss_determinant.
+  // Возвращает номера столбцов ведущих элементов, i-й из них стоит в строке i
+  std::vector<size_t> make_row_echelon() const {
+    std::vector<size_t> pivots;
+    value_type previous_pivot = value_type(1);
+    value_type threshold = value_type(0);
+    if constexpr (std::is_floating_point<value_type>::value) {
+      for (size_t i = 0; i < vertical_size(); i++) {
+        const T *line = (*this)[i];
+        value_type sum = value_type(0);
+        for (size_t j = 0; j < horizontal_size(); j++) {
+          sum += my_abs(line[j]);
+        }
+        threshold = std::max(threshold, sum);
+      }
+      threshold *= std::max(vertical_size(), horizontal_size()) * std::min(vertical_size(), horizontal_size()) *
+                   std::numeric_limits<value_type>::epsilon();
+    }
+    for (size_t column = 0, row = 0; row < vertical_size() && column < horizontal_size(); column++) {
+      size_t pivot = row;
+      for (size_t i = row + 1; i < vertical_size(); i++) {
+        if (my_abs((*this)(i, column)) > my_abs((*this)(pivot, column))) {
+          pivot = i;
+        }
+      }
+      if (!(my_abs((*this)(pivot, column)) > threshold)) {
+        for (size_t i = row; i < vertical_size(); i++) {
+          (*this)(i, column) = value_type(0);
+        }
+        continue;
+      }
+      swap_lines(row, pivot);
+      pivots.push_back(column);
+
+      const T *pivot_line = (*this)[row];
+      size_t width = horizontal_size() - column - 1;
+      auto eliminate = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+          T *line = (*this)[i];
+          if constexpr (std::is_integral<value_type>::value) {
+            // Строку с нулём в ведущем столбце тоже нужно домножить на p / p'
+            using Wide = typename WideProduct<value_type>::type;
+            Wide pivot_value = pivot_line[column];
+            for (size_t j = column + 1; j < horizontal_size(); j++) {
+              line[j] = value_type((pivot_value * line[j] - Wide(line[column]) * pivot_line[j]) / previous_pivot);
+            }
+            line[column] = value_type(0);
+          } else {
+            if (line[column] == value_type(0)) continue;
+            value_type coefficient = line[column] / pivot_line[column];
+            line[column] = value_type(0);
+            vector_sub_scaled(width, coefficient, pivot_line + column + 1, line + column + 1);
+          }
+        }
+      };
+      if ((vertical_size() - row) * width >= 1 << 15) {
+        parallel_for(row + 1, vertical_size(), 16, eliminate);
+      } else {
+        eliminate(row + 1, vertical_size());
+      }
+      previous_pivot = pivot_line[column];
+      row++;
+    }
+    return pivots;
+  }
+
+ private:
+  T *data_ = nullptr;
+  size_t vertical_size_ = 0;
+  size_t horizontal_size_ = 0;
+  size_t stride_ = 0;
+
+  template<typename E>
+  static Matrix<value_type> copy_of(const MatrixExpression<E> &expression) {
+    return Matrix<value_type>(expression);
+  }
+
+  // Вызывает function(i, (*this)[i]) для всех строк, большие блоки обрабатываются параллельно
+  template<typename Function>
+  void for_each_line(const Function &function) const {
+    auto process = [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        function(i, (*this)[i]);
+      }
+    };
+    if (vertical_size_ * horizontal_size_ >= 1 << 16) {
+      parallel_for(0, vertical_size_, 16, process);
+    } else {
+      process(0, vertical_size_);
+    }
+  }
+};
+
+// Транспонированный блок без копирования: (i, j) читается из (j, i) исходного блока
+template<typename T>
+class TransposedMatrixView : public MatrixExpression<TransposedMatrixView<T>> {
+ public:
+  using value_type = std::remove_const_t<T>;
+
+  explicit TransposedMatrixView(MatrixView<T> base) : base_(base) {
+  }
+
+  template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+  TransposedMatrixView(const TransposedMatrixView<U> &other) : base_(other.base()) {
+  }
+
+  size_t vertical_size() const {
+    return base_.horizontal_size();
+  }
+
+  size_t horizontal_size() const {
+    return base_.vertical_size();
+  }
+
+  T &operator()(size_t i, size_t j) const {
+    return base_(j, i);
+  }
+
+  const MatrixView<T> &base() const {
+    return base_;
+  }
+
+  // (i, j) читается из (j, i), поэтому опасно любое пересечение, даже с самим исходным блоком
+  template<typename V>
+  bool aliases(const MatrixView<V> &destination) const {
+    return base_.overlaps(destination);
+  }
+
+  TransposedMatrixView view() const {
+    return *this;
+  }
+
+ private:
+  MatrixView<T> base_;
+};
+
+template<typename T>
+TransposedMatrixView<T> MatrixView<T>::transposed() const {
+  return TransposedMatrixView<T>(*this);
+}
+
+// C += A * B или, если subtract, C -= A * B для блоков; C не должен пересекаться с A и B
+template<typename T>
+void multiply_accumulate(MatrixView<T> c, typename MatrixView<T>::const_view a,
+                         typename MatrixView<T>::const_view b, bool subtract) {
+  using value_type = typename MatrixView<T>::value_type;
+  if constexpr (std::is_arithmetic<value_type>::value) {
+    gemm(a.vertical_size(), b.horizontal_size(), a.horizontal_size(),
+         a.data(), a.stride(), b.data(), b.stride(), c.data(), c.stride(), false, subtract);
+  } else {
+    // Для точных типов умножение дорогое, поэтому нулевые элементы A пропускаются
+    parallel_for(0, a.vertical_size(), 4, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        for (size_t k = 0; k < a.horizontal_size(); k++) {
+          if (a(i, k) == value_type(0)) {
+            continue;
+          }
+          value_type coefficient = subtract ? -a(i, k) : a(i, k);
+          const value_type *b_line = b[k];
+          T *c_line = c[i];
+          for (size_t j = 0; j < b.horizontal_size(); j++) {
+            c_line[j] += coefficient * b_line[j];
+          }
+        }
+      }
+    });
+  }
+}
+
+// C += A * B для блоков; C не должен пересекаться с A и B
+template<typename T>
+void multiply_add(MatrixView<T> c, typename MatrixView<T>::const_view a, typename MatrixView<T>::const_view b) {
+  multiply_accumulate<T>(c, a, b, false);
+}
+
+// C -= A * B для блоков; C не должен пересекаться с A и B
+template<typename T>
+void multiply_subtract(MatrixView<T> c, typename MatrixView<T>::const_view a, typename MatrixView<T>::const_view b) {
+  multiply_accumulate<T>(c, a, b, true);
+}
+
+// C += A * B, где B задан транспонированным взглядом на построчно хранящуюся B^T
+template<typename T>
+void multiply_add(MatrixView<T> c, typename MatrixView<T>::const_view a,
+                  TransposedMatrixView<const typename MatrixView<T>::value_type> b) {
+  using value_type = typename MatrixView<T>::value_type;
+  typename MatrixView<T>::const_view bt = b.base();
+  if constexpr (std::is_arithmetic<value_type>::value) {
+    gemm(a.vertical_size(), bt.vertical_size(), a.horizontal_size(),
+         a.data(), a.stride(), bt.data(), bt.stride(), c.data(), c.stride(), true);
+  } else {
+    parallel_for(0, a.vertical_size(), 4, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        const value_type *a_line = a[i];
+        T *c_line = c[i];
+        for (size_t j = 0; j < bt.vertical_size(); j++) {
+          const value_type *bt_line = bt[j];
+          value_type sum = value_type(0);
+          for (size_t k = 0; k < a.horizontal_size(); k++) {
+            sum += a_line[k] * bt_line[k];
+          }
+          c_line[j] += sum;
+        }
+      }
+    });
+  }
+}
+
+#endif //LINEARALG_MATRIXVIEW_H
@@ -0,0 +1,203 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_MODINT_H
+#define LINEARALG_MODINT_H
+
+#include <cstdint>
+#include <iostream>
+#include "Simd.h"
+
+// Арифметика по нечётному модулю меньше 2^31 в форме Монтгомери: число x хранится как x * 2^32 mod m,
+// и умножение обходится одним умножением 64 бит и сдвигом вместо деления.
+// Модуль задаётся во время выполнения, поэтому одна и та же реализация работает и для ModInt<P>,
+// и для исключения по нескольким простым сразу.
+class Montgomery {
+ public:
+  constexpr explicit Montgomery(uint32_t modulus)
+          : modulus_(modulus), negated_inverse_(compute_negated_inverse(modulus)),
+            r2_(static_cast<uint32_t>((static_cast<uint64_t>(-1) % modulus + 1) % modulus)) {
+  }
+
+  constexpr uint32_t modulus() const {
+    return modulus_;
+  }
+
+  constexpr uint32_t negated_inverse() const {
+    return negated_inverse_;
+  }
+
+  // t * 2^-32 mod m для t < m * 2^32
+  constexpr uint32_t reduce(uint64_t t) const {
+    uint32_t q = static_cast<uint32_t>(t) * negated_inverse_;
+    uint32_t result = static_cast<uint32_t>((t + static_cast<uint64_t>(q) * modulus_) >> 32);
+    return result >= modulus_ ? result - modulus_ : result;
+  }
+
+  constexpr uint32_t to_montgomery(uint32_t value) const {
+    return reduce(static_cast<uint64_t>(value) * r2_);
+  }
+
+  constexpr uint32_t from_montgomery(uint32_t value) const {
+    return reduce(value);
+  }
+
+  constexpr uint32_t multiply(uint32_t lhs, uint32_t rhs) const {
+    return reduce(static_cast<uint64_t>(lhs) * rhs);
+  }
+
+  constexpr uint32_t add(uint32_t lhs, uint32_t rhs) const {
+    uint32_t result = lhs + rhs;
+    return result >= modulus_ ? result - modulus_ : result;
+  }
+
+  constexpr uint32_t subtract(uint32_t lhs, uint32_t rhs) const {
+    return lhs >= rhs ? lhs - rhs : lhs + modulus_ - rhs;
+  }
+
+  constexpr uint32_t power(uint32_t base, uint64_t exponent) const {
+    uint32_t result = to_montgomery(1);
+    while (exponent != 0) {
+      if (exponent & 1) {
+        result = multiply(result, base);
+      }
+      base = multiply(base, base);
+      exponent >>= 1;
+    }
+    return result;
+  }
+
+  // Обратный по малой теореме Ферма, модуль должен быть простым
+  constexpr uint32_t inverse(uint32_t value) const {
+    return power(value, modulus_ - 2);
+  }
+
+ private:
+  uint32_t modulus_;
+  uint32_t negated_inverse_;
+  uint32_t r2_;
+
+  // -m^-1 mod 2^32 методом Ньютона: каждый шаг удваивает число верных битов
+  static constexpr uint32_t compute_negated_inverse(uint32_t modulus) {
+    uint32_t inverse = modulus;
+    for (int i = 0; i < 5; i++) {
+      inverse *= 2 - modulus * inverse;
+    }
+    return -inverse;
+  }
+};
+
+// Вычет по простому модулю P < 2^31. Годится как тип элементов Matrix: определитель, gauss и solve
+// над ним считаются точно и без роста чисел. Сравнение сравнивает представителей из [0, P),
+// его хватает для выбора ненулевого главного элемента.
+template<uint32_t P>
+class ModInt {
+  static_assert(P % 2 == 1 && P < (1u << 31), "modulus must be an odd prime below 2^31");
+
+ public:
+  using value_type = long long;
+
+  ModInt(value_type value = 0)
+          : value_(reduction().to_montgomery(static_cast<uint32_t>((value % P + P) % P))) {
+  }
+
+  static constexpr uint32_t modulus() {
+    return P;
+  }
+
+  // Представитель из [0, P)
+  uint32_t value() const {
+    return reduction().from_montgomery(value_);
+  }
+
+  ModInt &operator+=(ModInt other) {
+    value_ = reduction().add(value_, other.value_);
+    return *this;
+  }
+
+  ModInt &operator-=(ModInt other) {
+    value_ = reduction().subtract(value_, other.value_);
+    return *this;
+  }
+
+  ModInt &operator*=(ModInt other) {
+    value_ = reduction().multiply(value_, other.value_);
+    return *this;
+  }
+
+  ModInt &operator/=(ModInt other) {
+    value_ = reduction().multiply(value_, reduction().inverse(other.value_));
+    return *this;
+  }
+
+  friend ModInt operator+(ModInt lhs, ModInt rhs) {
+    return lhs += rhs;
+  }
+
+  friend ModInt operator-(ModInt lhs, ModInt rhs) {
+    return lhs -= rhs;
+  }
+
+  friend ModInt operator*(ModInt lhs, ModInt rhs) {
+    return lhs *= rhs;
+  }
+
+  friend ModInt operator/(ModInt lhs, ModInt rhs) {
+    return lhs /= rhs;
+  }
+
+  ModInt operator-() const {
+    ModInt result;
+    result.value_ = reduction().subtract(0, value_);
+    return result;
+  }
+
+  ModInt operator+() const {
+    return *this;
+  }
+
+  ModInt power(unsigned long long exponent) const {
+    ModInt result;
+    result.value_ = reduction().power(value_, exponent);
+    return result;
+  }
+
+  ModInt inversed() const {
+    ModInt result;
+    result.value_ = reduction().inverse(value_);
+    return result;
+  }
+
+  // Форма Монтгомери взаимно однозначна, поэтому равенство проверяется без перевода
+  friend bool operator==(ModInt lhs, ModInt rhs) {
+    return lhs.value_ == rhs.value_;
+  }
+
+  friend bool operator!=(ModInt lhs, ModInt rhs) {
+    return lhs.value_ != rhs.value_;
+  }
+
+  friend bool operator<(ModInt lhs, ModInt rhs) {
+    return lhs.value() < rhs.value();
+  }
+
+  friend bool operator>(ModInt lhs, ModInt rhs) {
+    return rhs < lhs;
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, ModInt number) {
+    return out << number.value();
+  }
+
+ private:
+  uint32_t value_;
+
+  static constexpr const Montgomery &reduction() {
+    return REDUCTION;
+  }
+
+  static constexpr Montgomery REDUCTION = Montgomery(P);
+};
+
+#endif //LINEARALG_MODINT_H
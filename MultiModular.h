@@ -0,0 +1,395 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_MULTIMODULAR_H
+#define LINEARALG_MULTIMODULAR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "BigInteger.h"
+#include "Matrix.h"
+#include "ModInt.h"
+#include "ThreadPool.h"
+
+// Точные определитель, ранг и решение целочисленных систем: исключение Гаусса идёт по модулю
+// нескольких простых меньше 2^31 параллельно, а ответ собирается по китайской теореме об остатках.
+// Числа по ходу исключения не растут, так что каждое простое стоит как исключение над double.
+// Ответ хранится в BigInteger, а число простых выбирается по оценке Адамара, так что результат
+// точен при любом размере ответа: для матрицы 500 x 500 с элементами до 1000 это около 240 простых.
+
+// Детерминированный тест Миллера-Рабина: для чисел меньше 2^32 хватает оснований 2, 7 и 61
+inline bool is_prime(uint32_t number) {
+  if (number < 2 || number % 2 == 0) {
+    return number == 2;
+  }
+  Montgomery field(number);
+  uint32_t odd = number - 1;
+  int twos = 0;
+  while (odd % 2 == 0) {
+    odd /= 2;
+    twos++;
+  }
+  uint32_t one = field.to_montgomery(1);
+  uint32_t minus_one = field.to_montgomery(number - 1);
+  for (uint32_t base : {2u, 7u, 61u}) {
+    if (base % number == 0) continue;
+    uint32_t x = field.power(field.to_montgomery(base), odd);
+    if (x == one || x == minus_one) continue;
+    bool composite = true;
+    for (int i = 1; i < twos && composite; i++) {
+      x = field.multiply(x, x);
+      composite = x != minus_one;
+    }
+    if (composite) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// count наибольших простых меньше 2^31
+inline std::vector<uint32_t> modular_primes(size_t count) {
+  std::vector<uint32_t> result;
+  for (uint32_t candidate = (1u << 31) - 1; result.size() < count; candidate -= 2) {
+    if (is_prime(candidate)) {
+      result.push_back(candidate);
+    }
+  }
+  return result;
+}
+
+// Итог исключения по одному модулю
+struct ModularEchelon {
+  std::vector<size_t> pivot_columns;
+  uint32_t determinant = 0;
+};
+
+// Приводит построчно хранящуюся матрицу rows x columns с элементами из [0, p) к ступенчатому виду
+// по первым eliminated_columns столбцам; при reduced - к улучшенному, с единицами на ведущих местах.
+// determinant - определитель левого квадратного блока, если матрица им начинается.
+inline ModularEchelon modular_echelon(uint32_t prime, std::vector<uint32_t> &data, size_t rows, size_t columns,
+                                      size_t eliminated_columns, bool reduced) {
+  Montgomery field(prime);
+  for (uint32_t &value : data) {
+    value = field.to_montgomery(value);
+  }
+  auto line = [&](size_t i) {
+    return data.data() + i * columns;
+  };
+
+  ModularEchelon result;
+  uint32_t determinant = field.to_montgomery(1);
+  size_t row = 0;
+  for (size_t column = 0; column < eliminated_columns && row < rows; column++) {
+    size_t pivot = row;
+    while (pivot < rows && line(pivot)[column] == 0) {
+      pivot++;
+    }
+    if (pivot == rows) {
+      determinant = 0;
+      continue;
+    }
+    if (pivot != row) {
+      std::swap_ranges(line(pivot), line(pivot) + columns, line(row));
+      determinant = field.subtract(0, determinant);
+    }
+    uint32_t *pivot_line = line(row);
+    determinant = field.multiply(determinant, pivot_line[column]);
+    uint32_t inverse = field.inverse(pivot_line[column]);
+    for (size_t j = column; j < columns; j++) {
+      pivot_line[j] = field.multiply(pivot_line[j], inverse);
+    }
+    for (size_t i = reduced ? 0 : row + 1; i < rows; i++) {
+      uint32_t *current_line = line(i);
+      uint32_t coefficient = current_line[column];
+      if (i == row || coefficient == 0) continue;
+      modular_sub_scaled(columns - column, coefficient, pivot_line + column, current_line + column,
+                         prime, field.negated_inverse());
+    }
+    result.pivot_columns.push_back(column);
+    row++;
+  }
+  if (row < eliminated_columns) {
+    determinant = 0;
+  }
+
+  for (uint32_t &value : data) {
+    value = field.from_montgomery(value);
+  }
+  result.determinant = field.from_montgomery(determinant);
+  return result;
+}
+
+template<typename T>
+std::vector<uint32_t> reduce_modulo(const Matrix<T> &matrix, uint32_t prime, size_t extra_columns = 0) {
+  static_assert(std::is_integral<T>::value, "multi-modular elimination needs an integer matrix");
+  size_t columns = matrix.horizontal_size() + extra_columns;
+  std::vector<uint32_t> result(matrix.vertical_size() * columns);
+  for (size_t i = 0; i < matrix.vertical_size(); i++) {
+    for (size_t j = 0; j < matrix.horizontal_size(); j++) {
+      long long value = static_cast<long long>(matrix[i][j]) % static_cast<long long>(prime);
+      result[i * columns + j] = static_cast<uint32_t>(value < 0 ? value + prime : value);
+    }
+  }
+  return result;
+}
+
+// Собирает целое по остаткам от деления на фиксированный набор простых методом Гарнера: сначала
+// считаются цифры x = t_0 + t_1 p_0 + t_2 p_0 p_1 + ... по машинным модулям, затем число по схеме Горнера.
+// Обратные к произведениям префиксов считаются один раз, поэтому один накопитель выгодно использовать
+// для всех координат ответа. Возвращает представителя из (-M/2, M/2], M - произведение простых
+class ChineseRemainder {
+ public:
+  explicit ChineseRemainder(std::vector<uint32_t> primes) : primes_(std::move(primes)), inverses_(primes_.size()) {
+    modulus_ = 1;
+    for (size_t i = 0; i < primes_.size(); i++) {
+      uint32_t prime = primes_[i];
+      uint64_t prefix = 1;
+      for (size_t j = 0; j < i; j++) {
+        prefix = prefix * primes_[j] % prime;
+      }
+      Montgomery field(prime);
+      inverses_[i] = field.from_montgomery(field.inverse(field.to_montgomery(static_cast<uint32_t>(prefix))));
+      modulus_ *= BigInteger(prime);
+    }
+  }
+
+  const BigInteger &modulus() const {
+    return modulus_;
+  }
+
+  // residue(i) - остаток по i-му простому
+  template<typename Residue>
+  BigInteger operator()(const Residue &residue) const {
+    std::vector<uint32_t> digits(primes_.size());
+    for (size_t i = 0; i < primes_.size(); i++) {
+      uint64_t prime = primes_[i];
+      // Значение уже найденных цифр по модулю p_i
+      uint64_t known = 0;
+      for (size_t j = i; j-- > 0;) {
+        known = (known * primes_[j] + digits[j]) % prime;
+      }
+      digits[i] = static_cast<uint32_t>((residue(i) + prime - known) % prime * inverses_[i] % prime);
+    }
+    BigInteger result = 0;
+    for (size_t i = primes_.size(); i-- > 0;) {
+      result *= BigInteger(primes_[i]);
+      result += BigInteger(digits[i]);
+    }
+    if (result + result > modulus_) {
+      result -= modulus_;
+    }
+    return result;
+  }
+
+ private:
+  std::vector<uint32_t> primes_;
+  std::vector<uint32_t> inverses_;
+  BigInteger modulus_;
+};
+
+// log2 евклидовых норм строк и столбцов; у нулевых -бесконечность
+template<typename T>
+void norm_bits(const Matrix<T> &matrix, std::vector<long double> &rows, std::vector<long double> &columns) {
+  rows.assign(matrix.vertical_size(), 0);
+  columns.assign(matrix.horizontal_size(), 0);
+  for (size_t i = 0; i < matrix.vertical_size(); i++) {
+    for (size_t j = 0; j < matrix.horizontal_size(); j++) {
+      long double square = static_cast<long double>(matrix[i][j]) * matrix[i][j];
+      rows[i] += square;
+      columns[j] += square;
+    }
+  }
+  for (long double &value : rows) {
+    value = std::log2(value) / 2;
+  }
+  for (long double &value : columns) {
+    value = std::log2(value) / 2;
+  }
+}
+
+// Сколько простых из modular_primes нужно, чтобы восстановить число с |x| < 2^bits.
+// Все они больше 2^30, а запас в 2 бита покрывает знак и погрешность оценки
+inline size_t primes_for_bits(long double bits) {
+  return static_cast<size_t>(std::max<long double>(bits + 2, 0) / 30) + 1;
+}
+
+// Запускает job(index, prime) для каждого простого параллельно
+template<typename Job>
+void for_each_prime(const std::vector<uint32_t> &primes, const Job &job) {
+  parallel_for(0, primes.size(), 1, [&](size_t first, size_t last) {
+    for (size_t index = first; index < last; index++) {
+      job(index, primes[index]);
+    }
+  });
+}
+
+// Определитель; простых берётся столько, чтобы их произведение было больше удвоенной оценки Адамара
+// |det| <= prod ||a_i|| по строкам или по столбцам, так что ответ точен. Для неквадратной матрицы пуст
+template<typename T>
+std::optional<BigInteger> multimodular_determinant(const Matrix<T> &matrix) {
+  size_t n = matrix.vertical_size();
+  if (n != matrix.horizontal_size()) {
+    return std::nullopt;
+  }
+  std::vector<long double> rows, columns;
+  norm_bits(matrix, rows, columns);
+  long double bits = std::min(std::accumulate(rows.begin(), rows.end(), 0.0L),
+                              std::accumulate(columns.begin(), columns.end(), 0.0L));
+  if (std::isinf(bits)) {
+    return BigInteger(0);
+  }
+
+  std::vector<uint32_t> primes = modular_primes(primes_for_bits(bits));
+  std::vector<uint32_t> residues(primes.size());
+  for_each_prime(primes, [&](size_t index, uint32_t prime) {
+    std::vector<uint32_t> data = reduce_modulo(matrix, prime);
+    residues[index] = modular_echelon(prime, data, n, n, n, false).determinant;
+  });
+  return ChineseRemainder(primes)([&](size_t index) {
+    return residues[index];
+  });
+}
+
+// Ранг над Q равен рангу по модулю p, если p не делит хотя бы один ненулевой минор порядка rank. По оценке
+// Адамара такой минор меньше произведения min(m, n) наибольших норм строк (и так же столбцов), и простых
+// из modular_primes, делящих его, не больше bits / 30, так что максимум рангов по primes_for_bits(bits) простым
+// точен. Простые берутся партиями растущего размера: как только ранг по модулю равен min(m, n), ответ известен
+template<typename T>
+size_t multimodular_rank(const Matrix<T> &matrix) {
+  size_t limit = std::min(matrix.vertical_size(), matrix.horizontal_size());
+  std::vector<long double> rows, columns;
+  norm_bits(matrix, rows, columns);
+  auto largest_bits = [&](std::vector<long double> &norms) {
+    std::sort(norms.begin(), norms.end(), std::greater<long double>());
+    long double sum = 0;
+    for (size_t i = 0; i < std::min(limit, norms.size()) && !std::isinf(norms[i]); i++) {
+      sum += norms[i];
+    }
+    return sum;
+  };
+  long double bits = std::min(largest_bits(rows), largest_bits(columns));
+  std::vector<uint32_t> primes = modular_primes(primes_for_bits(bits));
+  size_t result = 0;
+  for (size_t first = 0, batch = 2; first < primes.size() && result < limit; first += batch, batch *= 2) {
+    std::vector<uint32_t> part(primes.begin() + first, primes.begin() + std::min(primes.size(), first + batch));
+    std::vector<size_t> ranks(part.size());
+    for_each_prime(part, [&](size_t index, uint32_t prime) {
+      std::vector<uint32_t> data = reduce_modulo(matrix, prime);
+      ranks[index] = modular_echelon(prime, data, matrix.vertical_size(), matrix.horizontal_size(),
+                                     matrix.horizontal_size(), false).pivot_columns.size();
+    });
+    result = std::max(result, *std::max_element(ranks.begin(), ranks.end()));
+  }
+  return result;
+}
+
+// Решение x = numerators / denominator; дроби не сокращены, denominator = |det A|.
+// Для вырожденной или неквадратной системы numerators пуст
+struct MultimodularSolution {
+  std::vector<BigInteger> numerators;
+  BigInteger denominator = 1;
+
+  // Несократимая дробь для x_i
+  std::pair<BigInteger, BigInteger> fraction(size_t i) const {
+    BigInteger divisor = gcd(numerators[i], denominator);
+    return {numerators[i] / divisor, denominator / divisor};
+  }
+};
+
+// Решение квадратной системы Ax = b по правилу Крамера: det(A) x_i = det(A_i), где в A_i столбец i заменён на b,
+// - целые числа, и их оценка Адамара по столбцам задаёт нужное число простых. По модулю каждого простого
+// det(A) x_i считается из решения и определителя, простые, делящие det A, пропускаются и заменяются новыми.
+// Ненулевой определитель делится не больше чем на bits / 30 таких простых, поэтому если вырожденных
+// простых больше, вырождена и сама матрица
+template<typename T>
+MultimodularSolution multimodular_solve(const Matrix<T> &matrix, const std::vector<T> &b) {
+  size_t n = matrix.vertical_size();
+  if (n != matrix.horizontal_size() || b.size() != n) {
+    return {};
+  }
+  std::vector<long double> rows, columns;
+  norm_bits(matrix, rows, columns);
+  long double determinant_bits = std::min(std::accumulate(rows.begin(), rows.end(), 0.0L),
+                                          std::accumulate(columns.begin(), columns.end(), 0.0L));
+  if (std::isinf(determinant_bits)) {
+    return {};
+  }
+  long double b_bits = 0;
+  for (const T &value : b) {
+    b_bits += static_cast<long double>(value) * value;
+  }
+  b_bits = std::log2(b_bits) / 2;
+  long double bits = determinant_bits;
+  long double column_bits = std::accumulate(columns.begin(), columns.end(), 0.0L);
+  for (size_t i = 0; i < n; i++) {
+    bits = std::max(bits, column_bits - columns[i] + b_bits);
+  }
+  size_t needed = primes_for_bits(bits);
+  size_t allowed_singular = primes_for_bits(determinant_bits);
+
+  // scaled[index][i] = det(A) x_i по модулю простого, последний элемент - сам det(A)
+  std::vector<uint32_t> primes, good_primes;
+  std::vector<std::vector<uint32_t>> scaled, good_scaled;
+  while (good_primes.size() < needed) {
+    size_t processed = primes.size();
+    if (processed - good_primes.size() > allowed_singular) {
+      return {};
+    }
+    primes = modular_primes(processed + needed - good_primes.size());
+    scaled.resize(primes.size());
+    std::vector<uint32_t> batch(primes.begin() + processed, primes.end());
+    for_each_prime(batch, [&](size_t index, uint32_t prime) {
+      std::vector<uint32_t> data = reduce_modulo(matrix, prime, 1);
+      for (size_t i = 0; i < n; i++) {
+        long long value = static_cast<long long>(b[i]) % static_cast<long long>(prime);
+        data[i * (n + 1) + n] = static_cast<uint32_t>(value < 0 ? value + prime : value);
+      }
+      ModularEchelon echelon = modular_echelon(prime, data, n, n + 1, n, true);
+      std::vector<uint32_t> &result = scaled[processed + index];
+      if (echelon.pivot_columns.size() < n) {
+        return;
+      }
+      result.resize(n + 1);
+      for (size_t i = 0; i < n; i++) {
+        result[i] = static_cast<uint32_t>(static_cast<uint64_t>(data[i * (n + 1) + n]) * echelon.determinant % prime);
+      }
+      result[n] = echelon.determinant;
+    });
+    for (size_t index = processed; index < primes.size(); index++) {
+      if (!scaled[index].empty()) {
+        good_primes.push_back(primes[index]);
+        good_scaled.push_back(std::move(scaled[index]));
+      }
+    }
+  }
+
+  ChineseRemainder chinese_remainder(good_primes);
+  MultimodularSolution result;
+  result.numerators.resize(n);
+  parallel_for(0, n + 1, 1, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      BigInteger value = chinese_remainder([&](size_t index) {
+        return good_scaled[index][i];
+      });
+      (i < n ? result.numerators[i] : result.denominator) = std::move(value);
+    }
+  });
+  if (result.denominator.negative()) {
+    result.denominator = -result.denominator;
+    for (BigInteger &numerator : result.numerators) {
+      numerator = -numerator;
+    }
+  }
+  return result;
+}
+
+#endif //LINEARALG_MULTIMODULAR_H
@@ -9,6 +9,7 @@
 #include <ostream>
 #include <algorithm>
 #include <iostream>
+#include "Arena.h"
 #include "Utils.h"
 
 class Permutation;
@@ -90,7 +91,11 @@ class Permutation {
     }
   }
 
-  Permutation(const std::vector<int> &data) : data_(data) {
+  Permutation(const std::vector<int> &data) : data_(data.begin(), data.end()) {
+
+  }
+
+  Permutation(ArenaVector<int> data) : data_(std::move(data)) {
 
   }
 
@@ -98,21 +103,22 @@ class Permutation {
 
   }
 
+  // Более короткая перестановка считается продолженной тождественно, поэтому операнды не копируются
   Permutation operator*(const Permutation &other) const {
-    Permutation lhs = *this;
-    Permutation rhs = other;
-    lhs.resize(rhs.size());
-    rhs.resize(lhs.size());
-    std::vector<int> new_data(lhs.size());
-    for (int i = 0; i < lhs.size(); i++) {
-      new_data[i] = lhs[rhs[i]];
+    int lhs_size = static_cast<int>(size());
+    int rhs_size = static_cast<int>(other.size());
+    int new_size = std::max(lhs_size, rhs_size);
+    ArenaVector<int> new_data(new_size);
+    for (int i = 0; i < new_size; i++) {
+      int j = i < rhs_size ? other.data_[i] : i;
+      new_data[i] = j < lhs_size ? data_[j] : j;
     }
-    return Permutation(new_data);
+    return Permutation(std::move(new_data));
   }
 
   Permutation &operator*=(const Permutation &other) {
     Permutation result = (*this) * other;
-    data_ = result.data_;
+    data_ = std::move(result.data_);
     return *this;
   }
 
@@ -158,11 +164,11 @@ class Permutation {
   }
 
   Permutation &inverse() {
-    std::vector<int> new_data(size());
+    ArenaVector<int> new_data(size());
     for (int i = 0; i < size(); i++) {
       new_data[data_[i]] = i;
     }
-    data_ = new_data;
+    data_ = std::move(new_data);
     return *this;
   }
 
@@ -238,7 +244,7 @@ class Permutation {
   }
 
  private:
-  std::vector<int> data_;
+  ArenaVector<int> data_;
 };
 
 Permutation fast_pow(const Permutation &value, int power) {
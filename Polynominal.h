@@ -10,6 +10,7 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include "Arena.h"
 
 template<typename T>
 class Polynomial {
@@ -18,7 +19,12 @@ class Polynomial {
           : coefficients_(1, value) {
   }
 
-  explicit Polynomial(std::vector<T> coefficients)
+  explicit Polynomial(const std::vector<T> &coefficients)
+          : coefficients_(coefficients.begin(), coefficients.end()) {
+    resize();
+  }
+
+  explicit Polynomial(ArenaVector<T> coefficients)
           : coefficients_(std::move(coefficients)) {
     resize();
   }
@@ -72,10 +78,10 @@ class Polynomial {
     return *this;
   }
 
-  friend Polynomial operator+(const Polynomial &lhs, const Polynomial &rhs) {
-    Polynomial result = lhs;
-    result += rhs;
-    return result;
+  // Левый операнд принимается по значению: временный многочлен отдаёт свой буфер результату без копирования
+  friend Polynomial operator+(Polynomial lhs, const Polynomial &rhs) {
+    lhs += rhs;
+    return lhs;
   }
 
   Polynomial &operator-=(const Polynomial &other) {
@@ -89,15 +95,14 @@ class Polynomial {
     return *this;
   }
 
-  friend Polynomial operator-(const Polynomial &lhs, const Polynomial &rhs) {
-    Polynomial result = lhs;
-    result -= rhs;
-    return result;
+  friend Polynomial operator-(Polynomial lhs, const Polynomial &rhs) {
+    lhs -= rhs;
+    return lhs;
   }
 
   Polynomial &operator*=(const Polynomial &other) {
-    std::vector<T> result_coefficients =
-            std::vector<T>(coefficients_.size() + other.coefficients_.size());
+    ArenaVector<T> result_coefficients =
+            ArenaVector<T>(coefficients_.size() + other.coefficients_.size());
 
     for (int i = 0; i < static_cast<int>(coefficients_.size()); i++) {
       for (int j = 0; j < static_cast<int>(other.coefficients_.size()); j++) {
@@ -105,16 +110,15 @@ class Polynomial {
       }
     }
 
-    swap(coefficients_, result_coefficients);
+    coefficients_ = std::move(result_coefficients);
     resize();
 
     return *this;
   }
 
-  friend Polynomial operator*(const Polynomial &lhs, const Polynomial &rhs) {
-    Polynomial result = lhs;
-    result *= rhs;
-    return result;
+  friend Polynomial operator*(Polynomial lhs, const Polynomial &rhs) {
+    lhs *= rhs;
+    return lhs;
   }
 
   const T operator[](size_t degree) const {
@@ -153,34 +157,27 @@ class Polynomial {
   }
 
   Polynomial &operator/=(const Polynomial &other) {
-    Polynomial result = T(0);
-    for (int i = Degree() - other.Degree(); i >= 0; i--) {
-      T current_coefficient =
-              (*this)[i + other.Degree()] / other[other.Degree()];
-      std::vector<T> current_degree_coefficients(static_cast<size_t >(i) + 1);
-      current_degree_coefficients[i] = T(1);
-      result += current_coefficient * Polynomial(current_degree_coefficients);
-      *this -= current_coefficient * Polynomial(current_degree_coefficients) * other;
-    }
-    swap(coefficients_, result.coefficients_);
+    ArenaVector<T> quotient;
+    divide(other, &quotient);
+    coefficients_ = std::move(quotient);
+    resize();
     return *this;
   }
 
-  friend Polynomial operator/(const Polynomial &lhs, const Polynomial &rhs) {
-    Polynomial result = lhs;
-    result /= rhs;
-    return result;
+  friend Polynomial operator/(Polynomial lhs, const Polynomial &rhs) {
+    lhs /= rhs;
+    return lhs;
   }
 
   Polynomial &operator%=(const Polynomial &other) {
-    *this -= (*this / other) * other;
+    divide(other, nullptr);
+    resize();
     return *this;
   }
 
-  friend Polynomial operator%(const Polynomial &lhs, const Polynomial &rhs) {
-    Polynomial result = lhs;
-    result %= rhs;
-    return result;
+  friend Polynomial operator%(Polynomial lhs, const Polynomial &rhs) {
+    lhs %= rhs;
+    return lhs;
   }
 
   friend Polynomial operator,(Polynomial lhs, Polynomial rhs) {
@@ -194,20 +191,52 @@ class Polynomial {
     return lhs;
   }
 
+  // Буферы могут лежать в разных аренах, поэтому обмен идёт через перемещения, а не vector::swap
   friend void swap(Polynomial &a, Polynomial &b) {
-    std::swap(a.coefficients_, b.coefficients_);
+    ArenaVector<T> coefficients = std::move(a.coefficients_);
+    a.coefficients_ = std::move(b.coefficients_);
+    b.coefficients_ = std::move(coefficients);
   }
 
-  Polynomial operator-() const {
+  Polynomial operator-() const & {
     Polynomial tmp = *this;
-    for (auto &item : tmp.coefficients_) {
+    return -std::move(tmp);
+  }
+
+  Polynomial operator-() && {
+    for (auto &item : coefficients_) {
       item = -item;
     }
-    return tmp;
+    return std::move(*this);
   }
 
  private:
-  std::vector<T> coefficients_;
+  ArenaVector<T> coefficients_;
+
+  // Деление столбиком на месте: в коэффициентах остаётся остаток, частное пишется в quotient, если он задан
+  void divide(const Polynomial &other, ArenaVector<T> *quotient) {
+    int degree = Degree();
+    int other_degree = other.Degree();
+    if (degree < other_degree) {
+      if (quotient != nullptr) {
+        quotient->assign(1, T(0));
+      }
+      return;
+    }
+    if (quotient != nullptr) {
+      quotient->assign(static_cast<size_t>(degree - other_degree) + 1, T(0));
+    }
+    for (int i = degree - other_degree; i >= 0; i--) {
+      T current_coefficient = coefficients_[i + other_degree] / other.coefficients_[other_degree];
+      if (quotient != nullptr) {
+        (*quotient)[i] = current_coefficient;
+      }
+      for (int j = 0; j < other_degree; j++) {
+        coefficients_[i + j] -= current_coefficient * other.coefficients_[j];
+      }
+      coefficients_[i + other_degree] = T(0);
+    }
+  }
 
   void resize() {
     size_t new_size = coefficients_.size();
@@ -0,0 +1,337 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_QR_H
+#define LINEARALG_QR_H
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include "Matrix.h"
+
+// Ширина полосы столбцов в блочном QR
+constexpr size_t QR_BLOCK_SIZE = 32;
+
+// Разложение A P = Q R отражениями Хаусхолдера для прямоугольной m x n матрицы из чисел с плавающей точкой.
+// Q = H_0 H_1 ... H_(k-1), H_i = E - tau_i v_i v_i^T, где v_i хранится под диагональю factors() в столбце i
+// (единица на диагонали не хранится), R - на диагонали и выше.
+// Без выбора столбцов (P = E) разложение блочное: полоса из QR_BLOCK_SIZE отражений собирается в компактное
+// WY-представление E - V T V^T, и остаток матрицы обновляется тремя умножениями блоков через gemm.
+// С выбором столбцов на каждом шаге берётся столбец наибольшей остаточной нормы, так что |R_ii| убывают
+// и rank() показывает численный ранг; этот вариант построчный и медленнее.
+template<typename T>
+class QR {
+ public:
+  explicit QR(Matrix<T> matrix, bool column_pivoting = false)
+          : factors_(std::move(matrix)), tau_(std::min(factors_.vertical_size(), factors_.horizontal_size())),
+            permutation_(factors_.horizontal_size()), pivoting_(column_pivoting) {
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+    if (column_pivoting) {
+      factorize_pivoting();
+    } else {
+      factorize();
+    }
+  }
+
+  size_t vertical_size() const {
+    return factors_.vertical_size();
+  }
+
+  size_t horizontal_size() const {
+    return factors_.horizontal_size();
+  }
+
+  const Matrix<T> &factors() const {
+    return factors_;
+  }
+
+  const std::vector<T> &tau() const {
+    return tau_;
+  }
+
+  // Столбец j матрицы A P - это столбец column_permutation()[j] исходной матрицы
+  const std::vector<size_t> &column_permutation() const {
+    return permutation_;
+  }
+
+  // Число диагональных элементов R, больших tolerance * max |R_ii|; по умолчанию tolerance = max(m, n) * eps.
+  // Как численный ранг имеет смысл только при выборе столбцов: тогда |R_ii| убывают и считаются первые из них
+  size_t rank(double tolerance = -1) const {
+    if (tolerance < 0) {
+      tolerance = std::max(vertical_size(), horizontal_size()) * std::numeric_limits<T>::epsilon();
+    }
+    T largest = T(0);
+    for (size_t i = 0; i < tau_.size(); i++) {
+      largest = std::max(largest, std::abs(factors_[i][i]));
+    }
+    T threshold = tolerance * largest;
+    size_t result = 0;
+    for (size_t i = 0; i < tau_.size(); i++) {
+      if (std::abs(factors_[i][i]) > threshold) {
+        result++;
+      } else if (pivoting_) {
+        break;
+      }
+    }
+    return result;
+  }
+
+  // Верхнетрапециевидная R размера min(m, n) x n
+  Matrix<T> r() const {
+    Matrix<T> result(horizontal_size(), tau_.size());
+    for (size_t i = 0; i < tau_.size(); i++) {
+      std::copy(factors_[i] + i, factors_[i] + horizontal_size(), result[i] + i);
+    }
+    return result;
+  }
+
+  // Первые min(m, n) столбцов Q
+  Matrix<T> q() const {
+    size_t m = vertical_size();
+    size_t k = tau_.size();
+    Matrix<T> result(k, m);
+    for (size_t i = 0; i < k; i++) {
+      result[i][i] = T(1);
+    }
+    std::vector<T> w(k);
+    for (size_t step = k; step-- > 0;) {
+      apply_reflector(step, result.view(), w);
+    }
+    return result;
+  }
+
+  // Q^T b для вектора длины m
+  std::vector<T> transposed_q_times(std::vector<T> b) const {
+    for (size_t step = 0; step < tau_.size(); step++) {
+      T w = b[step];
+      for (size_t i = step + 1; i < vertical_size(); i++) {
+        w += factors_[i][step] * b[i];
+      }
+      w *= tau_[step];
+      b[step] -= w;
+      for (size_t i = step + 1; i < vertical_size(); i++) {
+        b[i] -= w * factors_[i][step];
+      }
+    }
+    return b;
+  }
+
+  // x с наименьшей |A x - b|. При выборе столбцов и неполном ранге r возвращается базисное решение:
+  // ненулевые только r компонент при первых r выбранных столбцах. Без выбора столбцов для матрицы
+  // неполного ранга возвращает пустой вектор
+  std::vector<T> least_squares(const std::vector<T> &b) const {
+    size_t k = tau_.size();
+    size_t r = rank();
+    if (!pivoting_ && r != k) {
+      return {};
+    }
+    std::vector<T> c = transposed_q_times(b);
+    std::vector<T> y(horizontal_size(), T(0));
+    for (size_t i = r; i-- > 0;) {
+      T sum = c[i];
+      const T *line = factors_[i];
+      for (size_t j = i + 1; j < r; j++) {
+        sum -= line[j] * y[j];
+      }
+      y[i] = sum / line[i];
+    }
+    std::vector<T> x(horizontal_size());
+    for (size_t j = 0; j < horizontal_size(); j++) {
+      x[permutation_[j]] = y[j];
+    }
+    return x;
+  }
+
+ private:
+  Matrix<T> factors_;
+  std::vector<T> tau_;
+  std::vector<size_t> permutation_;
+  bool pivoting_;
+
+  // Строит отражение для столбца column начиная со строки column, записывает beta на диагональ и v под неё
+  void make_reflector(size_t column) {
+    size_t m = vertical_size();
+    T alpha = factors_[column][column];
+    T sigma = T(0);
+    for (size_t i = column + 1; i < m; i++) {
+      sigma += factors_[i][column] * factors_[i][column];
+    }
+    if (sigma == T(0)) {
+      tau_[column] = T(0);
+      return;
+    }
+    T norm = std::sqrt(alpha * alpha + sigma);
+    // Знак выбирается противоположным alpha, чтобы alpha - beta не теряло точность при вычитании
+    T beta = alpha <= T(0) ? norm : -norm;
+    tau_[column] = (beta - alpha) / beta;
+    T scale = T(1) / (alpha - beta);
+    for (size_t i = column + 1; i < m; i++) {
+      factors_[i][column] *= scale;
+    }
+    factors_[column][column] = beta;
+  }
+
+  // a -= tau v (v^T a) для строк step..m блока a, w - буфер на ширину блока
+  void apply_reflector(size_t step, MatrixView<T> a, std::vector<T> &w) const {
+    size_t m = vertical_size();
+    size_t width = a.horizontal_size();
+    if (tau_[step] == T(0)) {
+      return;
+    }
+    std::copy(a[step], a[step] + width, w.begin());
+    for (size_t i = step + 1; i < m; i++) {
+      vector_sub_scaled(width, -factors_[i][step], a[i], w.data());
+    }
+    for (size_t j = 0; j < width; j++) {
+      w[j] *= tau_[step];
+    }
+    vector_sub_scaled(width, T(1), w.data(), a[step]);
+    for (size_t i = step + 1; i < m; i++) {
+      vector_sub_scaled(width, factors_[i][step], w.data(), a[i]);
+    }
+  }
+
+  void factorize() {
+    size_t m = vertical_size();
+    size_t n = horizontal_size();
+    size_t k = tau_.size();
+    std::vector<T> w(n);
+    for (size_t column = 0; column < k; column += QR_BLOCK_SIZE) {
+      size_t end = std::min(k, column + QR_BLOCK_SIZE);
+      size_t width = end - column;
+      // Полоса раскладывается построчными отражениями, которые меняют только её столбцы
+      for (size_t step = column; step < end; step++) {
+        make_reflector(step);
+        if (step + 1 < end) {
+          apply_reflector(step, factors_.view(0, step + 1, m, end), w);
+        }
+      }
+      if (end == n) {
+        break;
+      }
+
+      // V - единичная нижнетрапециевидная (m - column) x width, T - верхнетреугольная width x width,
+      // H_column ... H_(end-1) = E - V T V^T
+      size_t height = m - column;
+      Matrix<T> v(width, height);
+      for (size_t i = 0; i < height; i++) {
+        for (size_t j = 0; j < width && j <= i; j++) {
+          v[i][j] = i == j ? T(1) : factors_[column + i][column + j];
+        }
+      }
+      Matrix<T> vt = v.transposed();
+      Matrix<T> gram(width, width);
+      multiply<T>(gram.view(), vt.view(), vt.transposed_view());
+      Matrix<T> t(width, width);
+      for (size_t i = 0; i < width; i++) {
+        t[i][i] = tau_[column + i];
+        for (size_t p = 0; p < i; p++) {
+          T sum = T(0);
+          for (size_t q = p; q < i; q++) {
+            sum += t[p][q] * gram[q][i];
+          }
+          t[p][i] = -tau_[column + i] * sum;
+        }
+      }
+
+      // Q^T = E - V T^T V^T, поэтому A2 -= V (T^T (V^T A2))
+      MatrixView<T> trailing = factors_.view(column, end, m, n);
+      Matrix<T> product(n - end, width);
+      multiply<T>(product.view(), vt.view(), trailing);
+      Matrix<T> scaled = t.transposed() * product;
+      multiply_subtract<T>(trailing, v.view(), scaled.view());
+    }
+  }
+
+  void factorize_pivoting() {
+    size_t m = vertical_size();
+    size_t n = horizontal_size();
+    std::vector<T> norms(n, T(0));
+    for (size_t i = 0; i < m; i++) {
+      for (size_t j = 0; j < n; j++) {
+        norms[j] += factors_[i][j] * factors_[i][j];
+      }
+    }
+    std::vector<T> original_norms = norms;
+    std::vector<T> w(n);
+    for (size_t step = 0; step < tau_.size(); step++) {
+      size_t pivot = step;
+      for (size_t j = step + 1; j < n; j++) {
+        if (norms[j] > norms[pivot]) {
+          pivot = j;
+        }
+      }
+      if (pivot != step) {
+        for (size_t i = 0; i < m; i++) {
+          std::swap(factors_[i][pivot], factors_[i][step]);
+        }
+        std::swap(norms[pivot], norms[step]);
+        std::swap(original_norms[pivot], original_norms[step]);
+        std::swap(permutation_[pivot], permutation_[step]);
+      }
+      make_reflector(step);
+      if (step + 1 < n) {
+        apply_reflector(step, factors_.view(0, step + 1, m, n), w);
+      }
+      // Остаточные нормы уменьшаются на квадрат нового элемента строки step; когда от нормы остаётся
+      // малая доля, вычитание теряет точность, и она пересчитывается заново
+      for (size_t j = step + 1; j < n; j++) {
+        norms[j] -= factors_[step][j] * factors_[step][j];
+        if (norms[j] <= std::sqrt(std::numeric_limits<T>::epsilon()) * original_norms[j]) {
+          norms[j] = T(0);
+          for (size_t i = step + 1; i < m; i++) {
+            norms[j] += factors_[i][j] * factors_[i][j];
+          }
+          original_norms[j] = norms[j];
+        }
+      }
+    }
+  }
+};
+
+// Наименьшие квадраты для высокой узкой матрицы по схеме TSQR: строки делятся на блоки, каждый блок
+// раскладывается независимо (блоки делят между собой потоки) и сжимается до своего R и первых n компонент Q^T b,
+// затем раскладываются сложенные друг на друга R. Каждый блок помещается в кэш, а Q целиком не хранится.
+// Для матрицы неполного ранга возвращает пустой вектор
+template<typename T>
+std::vector<T> tsqr_least_squares(const Matrix<T> &a, const std::vector<T> &b, size_t block_height = 0) {
+  size_t m = a.vertical_size();
+  size_t n = a.horizontal_size();
+  if (block_height == 0) {
+    block_height = std::max<size_t>(4 * n, 4096);
+  }
+  if (m <= block_height) {
+    return QR<T>(a).least_squares(b);
+  }
+  size_t blocks = (m + block_height - 1) / block_height;
+  std::vector<Matrix<T>> reduced(blocks);
+  std::vector<std::vector<T>> rhs(blocks);
+  parallel_for(0, blocks, 1, [&](size_t first, size_t last) {
+    for (size_t block = first; block < last; block++) {
+      size_t top = block * block_height;
+      size_t bottom = std::min(m, top + block_height);
+      QR<T> qr(Matrix<T>(a.view(top, 0, bottom, n)));
+      reduced[block] = qr.r();
+      rhs[block] = qr.transposed_q_times(std::vector<T>(b.begin() + top, b.begin() + bottom));
+      rhs[block].resize(reduced[block].vertical_size());
+    }
+  });
+  size_t stacked_height = 0;
+  for (const Matrix<T> &r : reduced) {
+    stacked_height += r.vertical_size();
+  }
+  Matrix<T> stacked(n, stacked_height);
+  std::vector<T> stacked_rhs;
+  stacked_rhs.reserve(stacked_height);
+  size_t line = 0;
+  for (size_t block = 0; block < blocks; block++) {
+    stacked.view(line, 0, line + reduced[block].vertical_size(), n) = reduced[block].view();
+    line += reduced[block].vertical_size();
+    stacked_rhs.insert(stacked_rhs.end(), rhs[block].begin(), rhs[block].end());
+  }
+  return tsqr_least_squares(stacked, stacked_rhs, block_height);
+}
+
+#endif //LINEARALG_QR_H
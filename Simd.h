@@ -0,0 +1,474 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_SIMD_H
+#define LINEARALG_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define LINEARALG_SIMD_X86 1
+#include <immintrin.h>
+#define LINEARALG_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define LINEARALG_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+enum class SimdLevel {
+  Scalar,
+  Avx2,
+  Avx512
+};
+
+// Набор инструкций определяется один раз по cpuid, так что один бинарник работает на любом x86-64
+inline SimdLevel simd_level() {
+#ifdef LINEARALG_SIMD_X86
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return SimdLevel::Avx2;
+    }
+    return SimdLevel::Scalar;
+  }();
+  return level;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+template<typename Kernel>
+Kernel select_kernel(Kernel scalar, Kernel avx2, Kernel avx512) {
+  switch (simd_level()) {
+    case SimdLevel::Avx512:
+      return avx512;
+    case SimdLevel::Avx2:
+      return avx2;
+    default:
+      return scalar;
+  }
+}
+
+// Переносимые версии, они же используются для всех типов кроме float и double
+
+// y += x
+template<typename T>
+void reference_vector_add(size_t size, const T *x, T *y) {
+  for (size_t i = 0; i < size; i++) {
+    y[i] += x[i];
+  }
+}
+
+// x *= scalar
+template<typename T, typename S>
+void reference_vector_scale(size_t size, const S &scalar, T *x) {
+  for (size_t i = 0; i < size; i++) {
+    x[i] *= scalar;
+  }
+}
+
+// y -= x * scalar
+template<typename T>
+void reference_vector_sub_scaled(size_t size, const T &scalar, const T *x, T *y) {
+  for (size_t i = 0; i < size; i++) {
+    y[i] -= x[i] * scalar;
+  }
+}
+
+// y -= x * coefficient * 2^-32 mod modulus: произведение Монтгомери, все числа из [0, modulus), modulus < 2^31
+inline void reference_modular_sub_scaled(size_t size, uint32_t coefficient, const uint32_t *x, uint32_t *y,
+                                         uint32_t modulus, uint32_t negated_inverse) {
+  for (size_t i = 0; i < size; i++) {
+    uint64_t product = static_cast<uint64_t>(x[i]) * coefficient;
+    uint32_t q = static_cast<uint32_t>(product) * negated_inverse;
+    uint32_t reduced = static_cast<uint32_t>((product + static_cast<uint64_t>(q) * modulus) >> 32);
+    reduced = reduced >= modulus ? reduced - modulus : reduced;
+    y[i] = y[i] >= reduced ? y[i] - reduced : y[i] + modulus - reduced;
+  }
+}
+
+// y ^= x, строки матриц над GF(2)
+inline void reference_vector_xor(size_t size, const uint64_t *x, uint64_t *y) {
+  for (size_t i = 0; i < size; i++) {
+    y[i] ^= x[i];
+  }
+}
+
+// c[MR x NR] += a * b, панели упакованы так: a[p * MR + i], b[p * NR + j]
+template<typename T, size_t MR, size_t NR>
+void reference_gemm_kernel(size_t depth, const T *a, const T *b, T *c, size_t ldc) {
+  T accumulator[MR][NR] = {};
+  for (size_t p = 0; p < depth; p++) {
+    const T *a_column = a + p * MR;
+    const T *b_row = b + p * NR;
+    for (size_t i = 0; i < MR; i++) {
+      for (size_t j = 0; j < NR; j++) {
+        accumulator[i][j] += a_column[i] * b_row[j];
+      }
+    }
+  }
+  for (size_t i = 0; i < MR; i++) {
+    for (size_t j = 0; j < NR; j++) {
+      c[i * ldc + j] += accumulator[i][j];
+    }
+  }
+}
+
+#ifdef LINEARALG_SIMD_X86
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_add(size_t size, const double *x, double *y) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i)));
+  }
+  for (; i < size; i++) {
+    y[i] += x[i];
+  }
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_add(size_t size, const float *x, float *y) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+  }
+  for (; i < size; i++) {
+    y[i] += x[i];
+  }
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_scale(size_t size, const double &scalar, double *x) {
+  __m256d factor = _mm256_set1_pd(scalar);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(x + i, _mm256_mul_pd(_mm256_loadu_pd(x + i), factor));
+  }
+  for (; i < size; i++) {
+    x[i] *= scalar;
+  }
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_scale(size_t size, const float &scalar, float *x) {
+  __m256 factor = _mm256_set1_ps(scalar);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm256_storeu_ps(x + i, _mm256_mul_ps(_mm256_loadu_ps(x + i), factor));
+  }
+  for (; i < size; i++) {
+    x[i] *= scalar;
+  }
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_sub_scaled(size_t size, const double &scalar,
+                                                         const double *x, double *y) {
+  __m256d factor = _mm256_set1_pd(scalar);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(y + i, _mm256_fnmadd_pd(_mm256_loadu_pd(x + i), factor, _mm256_loadu_pd(y + i)));
+  }
+  for (; i < size; i++) {
+    y[i] -= x[i] * scalar;
+  }
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_sub_scaled(size_t size, const float &scalar,
+                                                         const float *x, float *y) {
+  __m256 factor = _mm256_set1_ps(scalar);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm256_storeu_ps(y + i, _mm256_fnmadd_ps(_mm256_loadu_ps(x + i), factor, _mm256_loadu_ps(y + i)));
+  }
+  for (; i < size; i++) {
+    y[i] -= x[i] * scalar;
+  }
+}
+
+// 6 x 8: двенадцать аккумуляторов ymm, две загрузки B и одна рассылка A на шаг
+LINEARALG_TARGET_AVX2 inline void avx2_gemm_kernel(size_t depth, const double *a, const double *b,
+                                                   double *c, size_t ldc) {
+  __m256d accumulator[6][2];
+  for (auto &line : accumulator) {
+    line[0] = _mm256_setzero_pd();
+    line[1] = _mm256_setzero_pd();
+  }
+  for (size_t p = 0; p < depth; p++) {
+    __m256d b0 = _mm256_loadu_pd(b + p * 8);
+    __m256d b1 = _mm256_loadu_pd(b + p * 8 + 4);
+#pragma GCC unroll 6
+    for (size_t i = 0; i < 6; i++) {
+      __m256d value = _mm256_broadcast_sd(a + p * 6 + i);
+      accumulator[i][0] = _mm256_fmadd_pd(value, b0, accumulator[i][0]);
+      accumulator[i][1] = _mm256_fmadd_pd(value, b1, accumulator[i][1]);
+    }
+  }
+  for (size_t i = 0; i < 6; i++) {
+    double *c_line = c + i * ldc;
+    _mm256_storeu_pd(c_line, _mm256_add_pd(_mm256_loadu_pd(c_line), accumulator[i][0]));
+    _mm256_storeu_pd(c_line + 4, _mm256_add_pd(_mm256_loadu_pd(c_line + 4), accumulator[i][1]));
+  }
+}
+
+// 6 x 16 для float
+LINEARALG_TARGET_AVX2 inline void avx2_gemm_kernel(size_t depth, const float *a, const float *b,
+                                                   float *c, size_t ldc) {
+  __m256 accumulator[6][2];
+  for (auto &line : accumulator) {
+    line[0] = _mm256_setzero_ps();
+    line[1] = _mm256_setzero_ps();
+  }
+  for (size_t p = 0; p < depth; p++) {
+    __m256 b0 = _mm256_loadu_ps(b + p * 16);
+    __m256 b1 = _mm256_loadu_ps(b + p * 16 + 8);
+#pragma GCC unroll 6
+    for (size_t i = 0; i < 6; i++) {
+      __m256 value = _mm256_broadcast_ss(a + p * 6 + i);
+      accumulator[i][0] = _mm256_fmadd_ps(value, b0, accumulator[i][0]);
+      accumulator[i][1] = _mm256_fmadd_ps(value, b1, accumulator[i][1]);
+    }
+  }
+  for (size_t i = 0; i < 6; i++) {
+    float *c_line = c + i * ldc;
+    _mm256_storeu_ps(c_line, _mm256_add_ps(_mm256_loadu_ps(c_line), accumulator[i][0]));
+    _mm256_storeu_ps(c_line + 8, _mm256_add_ps(_mm256_loadu_ps(c_line + 8), accumulator[i][1]));
+  }
+}
+
+// Восемь произведений Монтгомери за раз: _mm256_mul_epu32 умножает чётные 32-битные половины,
+// поэтому нечётные сдвигаются на их место и обрабатываются вторым потоком
+LINEARALG_TARGET_AVX2 inline void avx2_modular_sub_scaled(size_t size, uint32_t coefficient, const uint32_t *x,
+                                                          uint32_t *y, uint32_t modulus, uint32_t negated_inverse) {
+  __m256i factor = _mm256_set1_epi64x(coefficient);
+  __m256i modulus_wide = _mm256_set1_epi64x(modulus);
+  __m256i inverse_wide = _mm256_set1_epi64x(negated_inverse);
+  __m256i modulus_narrow = _mm256_set1_epi32(static_cast<int>(modulus));
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+    __m256i even = _mm256_mul_epu32(values, factor);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(values, 32), factor);
+    even = _mm256_add_epi64(even, _mm256_mul_epu32(_mm256_mul_epu32(even, inverse_wide), modulus_wide));
+    odd = _mm256_add_epi64(odd, _mm256_mul_epu32(_mm256_mul_epu32(odd, inverse_wide), modulus_wide));
+    even = _mm256_srli_epi64(even, 32);
+    __m256i reduced = _mm256_blend_epi32(even, odd, 0b10101010);
+    // min(u, u - m) без знака оставляет u в [0, m), и так же исправляется отрицательная разность
+    reduced = _mm256_min_epu32(reduced, _mm256_sub_epi32(reduced, modulus_narrow));
+    __m256i difference = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + i)), reduced);
+    difference = _mm256_min_epu32(difference, _mm256_add_epi32(difference, modulus_narrow));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(y + i), difference);
+  }
+  reference_modular_sub_scaled(size - i, coefficient, x + i, y + i, modulus, negated_inverse);
+}
+
+LINEARALG_TARGET_AVX2 inline void avx2_vector_xor(size_t size, const uint64_t *x, uint64_t *y) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+    __m256i *target = reinterpret_cast<__m256i *>(y + i);
+    _mm256_storeu_si256(target, _mm256_xor_si256(_mm256_loadu_si256(target), values));
+  }
+  reference_vector_xor(size - i, x + i, y + i);
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_add(size_t size, const double *x, double *y) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_add_pd(_mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i)));
+  }
+  if (i < size) {
+    __mmask8 mask = static_cast<__mmask8>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_pd(y + i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, y + i),
+                                                     _mm512_maskz_loadu_pd(mask, x + i)));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_add(size_t size, const float *x, float *y) {
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_add_ps(_mm512_loadu_ps(y + i), _mm512_loadu_ps(x + i)));
+  }
+  if (i < size) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, y + i),
+                                                     _mm512_maskz_loadu_ps(mask, x + i)));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_scale(size_t size, const double &scalar, double *x) {
+  __m512d factor = _mm512_set1_pd(scalar);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(x + i, _mm512_mul_pd(_mm512_loadu_pd(x + i), factor));
+  }
+  if (i < size) {
+    __mmask8 mask = static_cast<__mmask8>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_pd(x + i, mask, _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, x + i), factor));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_scale(size_t size, const float &scalar, float *x) {
+  __m512 factor = _mm512_set1_ps(scalar);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    _mm512_storeu_ps(x + i, _mm512_mul_ps(_mm512_loadu_ps(x + i), factor));
+  }
+  if (i < size) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_ps(x + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, x + i), factor));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_sub_scaled(size_t size, const double &scalar,
+                                                             const double *x, double *y) {
+  __m512d factor = _mm512_set1_pd(scalar);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_fnmadd_pd(_mm512_loadu_pd(x + i), factor, _mm512_loadu_pd(y + i)));
+  }
+  if (i < size) {
+    __mmask8 mask = static_cast<__mmask8>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_pd(y + i, mask, _mm512_fnmadd_pd(_mm512_maskz_loadu_pd(mask, x + i), factor,
+                                                        _mm512_maskz_loadu_pd(mask, y + i)));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_sub_scaled(size_t size, const float &scalar,
+                                                             const float *x, float *y) {
+  __m512 factor = _mm512_set1_ps(scalar);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_fnmadd_ps(_mm512_loadu_ps(x + i), factor, _mm512_loadu_ps(y + i)));
+  }
+  if (i < size) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (size - i)) - 1);
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_fnmadd_ps(_mm512_maskz_loadu_ps(mask, x + i), factor,
+                                                        _mm512_maskz_loadu_ps(mask, y + i)));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_gemm_kernel(size_t depth, const double *a, const double *b,
+                                                       double *c, size_t ldc) {
+  __m512d accumulator[6];
+  for (auto &line : accumulator) {
+    line = _mm512_setzero_pd();
+  }
+  for (size_t p = 0; p < depth; p++) {
+    __m512d b_line = _mm512_loadu_pd(b + p * 8);
+#pragma GCC unroll 6
+    for (size_t i = 0; i < 6; i++) {
+      accumulator[i] = _mm512_fmadd_pd(_mm512_set1_pd(a[p * 6 + i]), b_line, accumulator[i]);
+    }
+  }
+  for (size_t i = 0; i < 6; i++) {
+    double *c_line = c + i * ldc;
+    _mm512_storeu_pd(c_line, _mm512_add_pd(_mm512_loadu_pd(c_line), accumulator[i]));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_gemm_kernel(size_t depth, const float *a, const float *b,
+                                                       float *c, size_t ldc) {
+  __m512 accumulator[6];
+  for (auto &line : accumulator) {
+    line = _mm512_setzero_ps();
+  }
+  for (size_t p = 0; p < depth; p++) {
+    __m512 b_line = _mm512_loadu_ps(b + p * 16);
+#pragma GCC unroll 6
+    for (size_t i = 0; i < 6; i++) {
+      accumulator[i] = _mm512_fmadd_ps(_mm512_set1_ps(a[p * 6 + i]), b_line, accumulator[i]);
+    }
+  }
+  for (size_t i = 0; i < 6; i++) {
+    float *c_line = c + i * ldc;
+    _mm512_storeu_ps(c_line, _mm512_add_ps(_mm512_loadu_ps(c_line), accumulator[i]));
+  }
+}
+
+LINEARALG_TARGET_AVX512 inline void avx512_vector_xor(size_t size, const uint64_t *x, uint64_t *y) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512i values = _mm512_loadu_si512(x + i);
+    _mm512_storeu_si512(y + i, _mm512_xor_si512(_mm512_loadu_si512(y + i), values));
+  }
+  reference_vector_xor(size - i, x + i, y + i);
+}
+
+#define LINEARALG_SELECT_KERNEL(type, scalar, name) \
+  select_kernel<type>(scalar, avx2_##name, avx512_##name)
+#else
+#define LINEARALG_SELECT_KERNEL(type, scalar, name) scalar
+#endif
+
+// Для всех типов, кроме float и double, используются переносимые версии
+
+template<typename T>
+void vector_add(size_t size, const T *x, T *y) {
+  reference_vector_add(size, x, y);
+}
+
+template<typename T, typename S>
+void vector_scale(size_t size, const S &scalar, T *x) {
+  reference_vector_scale(size, scalar, x);
+}
+
+template<typename T>
+void vector_sub_scaled(size_t size, const T &scalar, const T *x, T *y) {
+  reference_vector_sub_scaled(size, scalar, x, y);
+}
+
+#define LINEARALG_DISPATCHED_KERNELS(type, MR, NR) \
+  inline void vector_add(size_t size, const type *x, type *y) { \
+    using Kernel = void (*)(size_t, const type *, type *); \
+    static const Kernel kernel = LINEARALG_SELECT_KERNEL(Kernel, reference_vector_add<type>, vector_add); \
+    kernel(size, x, y); \
+  } \
+  inline void vector_scale(size_t size, const type &scalar, type *x) { \
+    using Kernel = void (*)(size_t, const type &, type *); \
+    static const Kernel kernel = \
+            LINEARALG_SELECT_KERNEL(Kernel, (reference_vector_scale<type, type>), vector_scale); \
+    kernel(size, scalar, x); \
+  } \
+  inline void vector_sub_scaled(size_t size, const type &scalar, const type *x, type *y) { \
+    using Kernel = void (*)(size_t, const type &, const type *, type *); \
+    static const Kernel kernel = \
+            LINEARALG_SELECT_KERNEL(Kernel, reference_vector_sub_scaled<type>, vector_sub_scaled); \
+    kernel(size, scalar, x, y); \
+  } \
+  inline void gemm_kernel(size_t depth, const type *a, const type *b, type *c, size_t ldc) { \
+    using Kernel = void (*)(size_t, const type *, const type *, type *, size_t); \
+    static const Kernel kernel = \
+            LINEARALG_SELECT_KERNEL(Kernel, (reference_gemm_kernel<type, MR, NR>), gemm_kernel); \
+    kernel(depth, a, b, c, ldc); \
+  }
+
+inline void modular_sub_scaled(size_t size, uint32_t coefficient, const uint32_t *x, uint32_t *y,
+                               uint32_t modulus, uint32_t negated_inverse) {
+  using Kernel = void (*)(size_t, uint32_t, const uint32_t *, uint32_t *, uint32_t, uint32_t);
+#ifdef LINEARALG_SIMD_X86
+  static const Kernel kernel = select_kernel<Kernel>(reference_modular_sub_scaled, avx2_modular_sub_scaled,
+                                                     avx2_modular_sub_scaled);
+#else
+  static const Kernel kernel = reference_modular_sub_scaled;
+#endif
+  kernel(size, coefficient, x, y, modulus, negated_inverse);
+}
+
+inline void vector_xor(size_t size, const uint64_t *x, uint64_t *y) {
+  using Kernel = void (*)(size_t, const uint64_t *, uint64_t *);
+#ifdef LINEARALG_SIMD_X86
+  static const Kernel kernel = select_kernel<Kernel>(reference_vector_xor, avx2_vector_xor, avx512_vector_xor);
+#else
+  static const Kernel kernel = reference_vector_xor;
+#endif
+  kernel(size, x, y);
+}
+
+LINEARALG_DISPATCHED_KERNELS(double, 6, 8)
+LINEARALG_DISPATCHED_KERNELS(float, 6, 16)
+
+#undef LINEARALG_DISPATCHED_KERNELS
+#undef LINEARALG_SELECT_KERNEL
+
+#endif //LINEARALG_SIMD_H
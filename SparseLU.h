@@ -0,0 +1,223 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_SPARSELU_H
+#define LINEARALG_SPARSELU_H
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SparseMatrix.h"
+
+// Разреженное разложение P A Q = L U по Гилберту-Пирлсу: столбцы обрабатываются слева направо в порядке Q,
+// и каждый из них получается разреженным треугольным решением с уже построенным L. Ненулевая структура
+// решения заранее находится обходом в глубину, так что работа пропорциональна числу операций с ненулями.
+// Q по умолчанию - порядок минимальной степени; главный элемент выбирается по столбцу с порогом:
+// диагональный элемент оставляется, если он не меньше pivot_threshold от максимального, это сохраняет
+// малое заполнение от Q и при этом ограничивает рост элементов.
+template<typename T>
+class SparseLU {
+ public:
+  explicit SparseLU(const SparseMatrix<T> &matrix, double pivot_threshold = 0.1)
+          : SparseLU(matrix, minimum_degree_ordering(matrix), pivot_threshold) {
+  }
+
+  SparseLU(const SparseMatrix<T> &matrix, std::vector<size_t> column_order, double pivot_threshold = 0.1)
+          : size_(matrix.vertical_size()), column_order_(std::move(column_order)) {
+    if (matrix.vertical_size() != matrix.horizontal_size() || column_order_.size() != size_) {
+      singular_ = true;
+      return;
+    }
+    factorize(matrix.transposed(), pivot_threshold);
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool singular() const {
+    return singular_;
+  }
+
+  // Число ненулей в L и U вместе с диагональю
+  size_t non_zeros() const {
+    return lower_values_.size() + upper_values_.size();
+  }
+
+  // Строка i матрицы PA - это строка row_order()[i] исходной матрицы
+  const std::vector<size_t> &row_order() const {
+    return row_order_;
+  }
+
+  // Столбец j матрицы AQ - это столбец column_order()[j] исходной матрицы
+  const std::vector<size_t> &column_order() const {
+    return column_order_;
+  }
+
+  // Для вырожденной матрицы возвращает пустой вектор
+  std::vector<T> solve(const std::vector<T> &b) const {
+    if (singular_) {
+      return {};
+    }
+    std::vector<T> y(size_);
+    for (size_t k = 0; k < size_; k++) {
+      y[k] = b[row_order_[k]];
+    }
+    for (size_t j = 0; j < size_; j++) {
+      if (y[j] == T(0)) continue;
+      for (size_t p = lower_offsets_[j] + 1; p < lower_offsets_[j + 1]; p++) {
+        y[lower_indices_[p]] -= lower_values_[p] * y[j];
+      }
+    }
+    // Диагональный элемент U записывается в столбец последним
+    for (size_t j = size_; j-- > 0;) {
+      size_t diagonal = upper_offsets_[j + 1] - 1;
+      y[j] /= upper_values_[diagonal];
+      if (y[j] == T(0)) continue;
+      for (size_t p = upper_offsets_[j]; p < diagonal; p++) {
+        y[upper_indices_[p]] -= upper_values_[p] * y[j];
+      }
+    }
+    std::vector<T> result(size_);
+    for (size_t k = 0; k < size_; k++) {
+      result[column_order_[k]] = y[k];
+    }
+    return result;
+  }
+
+ private:
+  static constexpr size_t NOT_PIVOTAL = static_cast<size_t>(-1);
+
+  size_t size_;
+  std::vector<size_t> column_order_;
+  std::vector<size_t> row_order_;
+  bool singular_ = false;
+
+  // L и U по столбцам (CSC). В L первым в столбце идёт единичный диагональный элемент
+  std::vector<size_t> lower_offsets_;
+  std::vector<size_t> lower_indices_;
+  std::vector<T> lower_values_;
+  std::vector<size_t> upper_offsets_;
+  std::vector<size_t> upper_indices_;
+  std::vector<T> upper_values_;
+
+  // columns - это A в формате CSC, то есть A^T в CSR
+  void factorize(const SparseMatrix<T> &columns, double pivot_threshold) {
+    size_t n = size_;
+    // pivot_position[i] - номер шага, на котором строка i стала ведущей
+    std::vector<size_t> pivot_position(n, NOT_PIVOTAL);
+    std::vector<T> x(n, T(0));
+    std::vector<size_t> pattern;
+    std::vector<bool> visited(n, false);
+    std::vector<std::pair<size_t, size_t>> stack;
+    lower_offsets_.assign(1, 0);
+    upper_offsets_.assign(1, 0);
+
+    for (size_t k = 0; k < n; k++) {
+      size_t column = column_order_[k];
+      size_t begin = columns.row_offsets()[column];
+      size_t end = columns.row_offsets()[column + 1];
+
+      // Структура L^{-1} A(:, column): строки, достижимые из ненулей столбца по рёбрам L.
+      // pattern заполняется в обратном топологическом порядке
+      pattern.clear();
+      for (size_t p = begin; p < end; p++) {
+        size_t start = columns.column_indices()[p];
+        if (visited[start]) continue;
+        visited[start] = true;
+        stack.push_back({start, 0});
+        while (!stack.empty()) {
+          size_t row = stack.back().first;
+          size_t step = pivot_position[row];
+          size_t child = NOT_PIVOTAL;
+          if (step != NOT_PIVOTAL) {
+            size_t &next = stack.back().second;
+            for (size_t q = lower_offsets_[step] + 1 + next; q < lower_offsets_[step + 1]; q++) {
+              next++;
+              if (!visited[lower_indices_[q]]) {
+                child = lower_indices_[q];
+                break;
+              }
+            }
+          }
+          if (child == NOT_PIVOTAL) {
+            stack.pop_back();
+            pattern.push_back(row);
+          } else {
+            visited[child] = true;
+            stack.push_back({child, 0});
+          }
+        }
+      }
+
+      for (size_t p = begin; p < end; p++) {
+        x[columns.column_indices()[p]] = columns.values()[p];
+      }
+      for (size_t index = pattern.size(); index-- > 0;) {
+        size_t row = pattern[index];
+        size_t step = pivot_position[row];
+        if (step == NOT_PIVOTAL || x[row] == T(0)) continue;
+        for (size_t q = lower_offsets_[step] + 1; q < lower_offsets_[step + 1]; q++) {
+          x[lower_indices_[q]] -= lower_values_[q] * x[row];
+        }
+      }
+
+      size_t pivot = NOT_PIVOTAL;
+      T largest = T(0);
+      for (size_t row : pattern) {
+        visited[row] = false;
+        if (pivot_position[row] != NOT_PIVOTAL) {
+          if (x[row] != T(0)) {
+            upper_indices_.push_back(pivot_position[row]);
+            upper_values_.push_back(x[row]);
+          }
+        } else if (x[row] != T(0) && (pivot == NOT_PIVOTAL || my_abs(x[row]) > largest)) {
+          pivot = row;
+          largest = my_abs(x[row]);
+        }
+      }
+      if (pivot == NOT_PIVOTAL) {
+        singular_ = true;
+        return;
+      }
+      // Для точных типов рост элементов не страшен, и любой ненулевой диагональный элемент подходит
+      if (pivot_position[column] == NOT_PIVOTAL && x[column] != T(0)) {
+        if constexpr (std::is_floating_point<T>::value) {
+          if (my_abs(x[column]) >= largest * pivot_threshold) {
+            pivot = column;
+          }
+        } else {
+          pivot = column;
+        }
+      }
+
+      T pivot_value = x[pivot];
+      upper_indices_.push_back(k);
+      upper_values_.push_back(pivot_value);
+      upper_offsets_.push_back(upper_values_.size());
+      pivot_position[pivot] = k;
+      lower_indices_.push_back(pivot);
+      lower_values_.push_back(T(1));
+      for (size_t row : pattern) {
+        if (pivot_position[row] == NOT_PIVOTAL && x[row] != T(0)) {
+          lower_indices_.push_back(row);
+          lower_values_.push_back(x[row] / pivot_value);
+        }
+        x[row] = T(0);
+      }
+      lower_offsets_.push_back(lower_values_.size());
+    }
+
+    // Номера строк L переводятся в номера шагов, чтобы решение не зависело от исходной нумерации
+    for (size_t &row : lower_indices_) {
+      row = pivot_position[row];
+    }
+    row_order_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+      row_order_[pivot_position[i]] = i;
+    }
+  }
+};
+
+#endif //LINEARALG_SPARSELU_H
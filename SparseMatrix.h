@@ -0,0 +1,306 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_SPARSEMATRIX_H
+#define LINEARALG_SPARSEMATRIX_H
+
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+#include "Matrix.h"
+
+template<typename T>
+class SparseLU;
+
+template<typename T>
+struct SparseEntry {
+  size_t row;
+  size_t column;
+  T value;
+};
+
+// Разреженная матрица в формате CSR: ненулевые элементы строки i - это values()[p] в столбцах
+// column_indices()[p] для p из [row_offsets()[i], row_offsets()[i + 1]), по возрастанию столбца.
+// Формат CSC матрицы A совпадает с CSR матрицы A^T, её даёт transposed().
+// Память и время всех операций пропорциональны числу ненулевых элементов, а не n^2.
+template<typename T>
+class SparseMatrix {
+ public:
+  using value_type = T;
+
+  SparseMatrix() : row_offsets_(1, 0) {
+
+  }
+
+  // Повторяющиеся позиции складываются, нули не хранятся
+  SparseMatrix(size_t horizontal_size, size_t vertical_size, std::vector<SparseEntry<T>> entries)
+          : vertical_size_(vertical_size), horizontal_size_(horizontal_size), row_offsets_(vertical_size + 1, 0) {
+    std::sort(entries.begin(), entries.end(), [](const SparseEntry<T> &lhs, const SparseEntry<T> &rhs) {
+      return lhs.row < rhs.row || (lhs.row == rhs.row && lhs.column < rhs.column);
+    });
+    column_indices_.reserve(entries.size());
+    values_.reserve(entries.size());
+    for (size_t p = 0; p < entries.size();) {
+      size_t row = entries[p].row;
+      size_t column = entries[p].column;
+      T value = entries[p].value;
+      for (p++; p < entries.size() && entries[p].row == row && entries[p].column == column; p++) {
+        value += entries[p].value;
+      }
+      if (value != T(0)) {
+        column_indices_.push_back(column);
+        values_.push_back(value);
+        row_offsets_[row + 1]++;
+      }
+    }
+    for (size_t i = 0; i < vertical_size_; i++) {
+      row_offsets_[i + 1] += row_offsets_[i];
+    }
+  }
+
+  explicit SparseMatrix(const Matrix<T> &dense)
+          : vertical_size_(dense.vertical_size()),
+            horizontal_size_(dense.horizontal_size()),
+            row_offsets_(1, 0) {
+    for (size_t i = 0; i < vertical_size_; i++) {
+      for (size_t j = 0; j < horizontal_size_; j++) {
+        if (dense[i][j] != T(0)) {
+          column_indices_.push_back(j);
+          values_.push_back(dense[i][j]);
+        }
+      }
+      row_offsets_.push_back(values_.size());
+    }
+  }
+
+  size_t vertical_size() const {
+    return vertical_size_;
+  }
+
+  size_t horizontal_size() const {
+    return horizontal_size_;
+  }
+
+  std::pair<size_t, size_t> size() const {
+    return {vertical_size(), horizontal_size()};
+  }
+
+  size_t non_zeros() const {
+    return values_.size();
+  }
+
+  const std::vector<size_t> &row_offsets() const {
+    return row_offsets_;
+  }
+
+  const std::vector<size_t> &column_indices() const {
+    return column_indices_;
+  }
+
+  const std::vector<T> &values() const {
+    return values_;
+  }
+
+  Matrix<T> dense() const {
+    Matrix<T> result(horizontal_size_, vertical_size_);
+    for (size_t i = 0; i < vertical_size_; i++) {
+      for (size_t p = row_offsets_[i]; p < row_offsets_[i + 1]; p++) {
+        result[i][column_indices_[p]] = values_[p];
+      }
+    }
+    return result;
+  }
+
+  // Сортировка подсчётом по столбцам, O(nnz + n)
+  SparseMatrix transposed() const {
+    SparseMatrix result;
+    result.vertical_size_ = horizontal_size_;
+    result.horizontal_size_ = vertical_size_;
+    result.row_offsets_.assign(horizontal_size_ + 1, 0);
+    result.column_indices_.resize(non_zeros());
+    result.values_.resize(non_zeros());
+    for (size_t column : column_indices_) {
+      result.row_offsets_[column + 1]++;
+    }
+    for (size_t j = 0; j < horizontal_size_; j++) {
+      result.row_offsets_[j + 1] += result.row_offsets_[j];
+    }
+    std::vector<size_t> position(result.row_offsets_.begin(), result.row_offsets_.end() - 1);
+    for (size_t i = 0; i < vertical_size_; i++) {
+      for (size_t p = row_offsets_[i]; p < row_offsets_[i + 1]; p++) {
+        size_t target = position[column_indices_[p]]++;
+        result.column_indices_[target] = i;
+        result.values_[target] = values_[p];
+      }
+    }
+    return result;
+  }
+
+  std::vector<T> operator*(const std::vector<T> &vector) const {
+    std::vector<T> result(vertical_size_, T(0));
+    parallel_for(0, vertical_size_, 1024, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        T sum = T(0);
+        for (size_t p = row_offsets_[i]; p < row_offsets_[i + 1]; p++) {
+          sum += values_[p] * vector[column_indices_[p]];
+        }
+        result[i] = sum;
+      }
+    });
+    return result;
+  }
+
+  Matrix<T> operator*(const Matrix<T> &other) const {
+    Matrix<T> result(other.horizontal_size(), vertical_size_);
+    parallel_for(0, vertical_size_, 64, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        for (size_t p = row_offsets_[i]; p < row_offsets_[i + 1]; p++) {
+          vector_sub_scaled(other.horizontal_size(), -values_[p], other[column_indices_[p]], result[i]);
+        }
+      }
+    });
+    return result;
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const SparseMatrix &matrix) {
+    out << "(";
+    for (size_t i = 0; i < matrix.vertical_size_; i++) {
+      for (size_t p = matrix.row_offsets_[i]; p < matrix.row_offsets_[i + 1]; p++) {
+        if (p != 0) {
+          out << ", ";
+        }
+        out << "(" << i << ", " << matrix.column_indices_[p] << "): " << matrix.values_[p];
+      }
+    }
+    out << ")";
+    return out;
+  }
+
+  // Для многократного решения с одной и той же матрицей лучше один раз построить lu()
+  SparseLU<T> lu() const {
+    return SparseLU<T>(*this);
+  }
+
+  // Для вырожденной матрицы возвращает пустой вектор, как и Matrix::solve
+  std::vector<T> solve(const std::vector<T> &b) const {
+    return SparseLU<T>(*this).solve(b);
+  }
+
+ private:
+  size_t vertical_size_ = 0;
+  size_t horizontal_size_ = 0;
+  std::vector<size_t> row_offsets_;
+  std::vector<size_t> column_indices_;
+  std::vector<T> values_;
+};
+
+// Приближённый порядок минимальной степени (AMD) для графа A + A^T: на каждом шаге исключается вершина
+// наименьшей степени. Граф исключения хранится в факторизованном виде: исключённая вершина становится
+// элементом, а её соседи, образующие клику, хранятся списком один раз вместо всех рёбер клики.
+// Степени оцениваются сверху, как у Аместо, Дэвиса и Даффа, так что шаг стоит порядка размеров списков.
+// Возвращает порядок столбцов (и строк) для SparseLU.
+template<typename T>
+std::vector<size_t> minimum_degree_ordering(const SparseMatrix<T> &matrix) {
+  size_t n = std::min(matrix.vertical_size(), matrix.horizontal_size());
+  // variables[i] - соседи-переменные, elements[i] - элементы, в которые входит i, members[e] - переменные элемента
+  std::vector<std::vector<size_t>> variables(n), elements(n), members(n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t p = matrix.row_offsets()[i]; p < matrix.row_offsets()[i + 1]; p++) {
+      size_t j = matrix.column_indices()[p];
+      if (j != i && j < n) {
+        variables[i].push_back(j);
+        variables[j].push_back(i);
+      }
+    }
+  }
+  std::vector<size_t> degree(n);
+  std::set<std::pair<size_t, size_t>> by_degree;
+  for (size_t i = 0; i < n; i++) {
+    std::sort(variables[i].begin(), variables[i].end());
+    variables[i].erase(std::unique(variables[i].begin(), variables[i].end()), variables[i].end());
+    degree[i] = variables[i].size();
+    by_degree.insert({degree[i], i});
+  }
+
+  const size_t NONE = static_cast<size_t>(-1);
+  std::vector<bool> eliminated(n, false), absorbed(n, false);
+  std::vector<size_t> in_pivot_element(n, NONE), outside(n, 0), outside_stamp(n, NONE);
+  std::vector<size_t> order;
+  order.reserve(n);
+  for (size_t step = 0; step < n; step++) {
+    size_t pivot = by_degree.begin()->second;
+    by_degree.erase(by_degree.begin());
+    eliminated[pivot] = true;
+    order.push_back(pivot);
+
+    // Новый элемент - все ещё не исключённые соседи pivot, в том числе через поглощаемые элементы
+    std::vector<size_t> &pivot_members = members[pivot];
+    in_pivot_element[pivot] = step;
+    auto add_member = [&](size_t v) {
+      if (!eliminated[v] && in_pivot_element[v] != step) {
+        in_pivot_element[v] = step;
+        pivot_members.push_back(v);
+      }
+    };
+    for (size_t v : variables[pivot]) {
+      add_member(v);
+    }
+    for (size_t e : elements[pivot]) {
+      if (absorbed[e]) continue;
+      for (size_t v : members[e]) {
+        add_member(v);
+      }
+      absorbed[e] = true;
+      std::vector<size_t>().swap(members[e]);
+    }
+    std::vector<size_t>().swap(variables[pivot]);
+    std::vector<size_t>().swap(elements[pivot]);
+
+    // outside[e] = |members[e] \ members[pivot]| для элементов, соседних с новым
+    for (size_t i : pivot_members) {
+      for (size_t e : elements[i]) {
+        if (absorbed[e]) continue;
+        if (outside_stamp[e] != step) {
+          outside_stamp[e] = step;
+          outside[e] = members[e].size();
+        }
+        outside[e]--;
+      }
+    }
+
+    size_t pivot_degree = pivot_members.size();
+    for (size_t i : pivot_members) {
+      by_degree.erase({degree[i], i});
+      // Рёбра внутри нового элемента больше не нужны, их покрывает сам элемент
+      size_t estimate = 0;
+      auto &element_list = elements[i];
+      element_list.erase(std::remove_if(element_list.begin(), element_list.end(), [&](size_t e) {
+        // Элемент целиком внутри нового поглощается
+        if (!absorbed[e] && outside[e] == 0 && outside_stamp[e] == step) {
+          absorbed[e] = true;
+          std::vector<size_t>().swap(members[e]);
+        }
+        return absorbed[e];
+      }), element_list.end());
+      for (size_t e : element_list) {
+        estimate += outside[e];
+      }
+      element_list.push_back(pivot);
+      auto &variable_list = variables[i];
+      variable_list.erase(std::remove_if(variable_list.begin(), variable_list.end(), [&](size_t v) {
+        return eliminated[v] || in_pivot_element[v] == step;
+      }), variable_list.end());
+      estimate += variable_list.size() + pivot_degree - 1;
+      degree[i] = std::min({estimate, degree[i] + pivot_degree - 1, n - step - 2});
+      by_degree.insert({degree[i], i});
+    }
+  }
+  return order;
+}
+
+#include "SparseLU.h"
+
+#endif //LINEARALG_SPARSEMATRIX_H
@@ -0,0 +1,164 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_STRASSEN_H
+#define LINEARALG_STRASSEN_H
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "MatrixView.h"
+
+inline std::atomic<size_t> &strassen_crossover_setting() {
+  static std::atomic<size_t> crossover(0);
+  return crossover;
+}
+
+// Умножение матриц, у которых все размеры не меньше crossover, идёт по Штрассену-Винограду.
+// 0 выключает этот режим; включён он или нет, решает только скорость, результат тот же
+// (для чисел с плавающей точкой - с точностью до порядка округлений)
+inline void set_strassen_crossover(size_t crossover) {
+  strassen_crossover_setting() = crossover;
+}
+
+inline size_t strassen_crossover() {
+  return strassen_crossover_setting();
+}
+
+// Временная матрица для промежуточных сумм и произведений
+template<typename T>
+class StrassenBuffer {
+ public:
+  StrassenBuffer(size_t vertical_size, size_t horizontal_size)
+          : data_(vertical_size * horizontal_size),
+            view_(data_.data(), vertical_size, horizontal_size, horizontal_size) {
+  }
+
+  StrassenBuffer(const StrassenBuffer &) = delete;
+
+  StrassenBuffer(StrassenBuffer &&) = default;
+
+  const MatrixView<T> &view() const {
+    return view_;
+  }
+
+ private:
+  std::vector<T> data_;
+  MatrixView<T> view_;
+};
+
+// C = A * B по схеме Винограда: 7 умножений и 15 сложений блоков на уровень вместо 8 умножений.
+// Нечётные размеры отщепляются: чётная часть считается рекурсивно, а последние строка, столбец
+// и слагаемое ранга 1 досчитываются обычным умножением. Ниже crossover работает обычное ядро.
+template<typename T>
+void strassen_multiply(MatrixView<T> c, typename MatrixView<T>::const_view a,
+                       typename MatrixView<T>::const_view b, size_t crossover) {
+  using value_type = typename MatrixView<T>::value_type;
+  size_t m = a.vertical_size();
+  size_t k = a.horizontal_size();
+  size_t n = b.horizontal_size();
+  crossover = std::max<size_t>(crossover, 2);
+  if (std::min({m, k, n}) < crossover) {
+    c.fill(value_type(0));
+    multiply_add<T>(c, a, b);
+    return;
+  }
+
+  size_t half_m = m / 2;
+  size_t half_k = k / 2;
+  size_t half_n = n / 2;
+  auto a11 = a.view(0, 0, half_m, half_k);
+  auto a12 = a.view(0, half_k, half_m, 2 * half_k);
+  auto a21 = a.view(half_m, 0, 2 * half_m, half_k);
+  auto a22 = a.view(half_m, half_k, 2 * half_m, 2 * half_k);
+  auto b11 = b.view(0, 0, half_k, half_n);
+  auto b12 = b.view(0, half_n, half_k, 2 * half_n);
+  auto b21 = b.view(half_k, 0, 2 * half_k, half_n);
+  auto b22 = b.view(half_k, half_n, 2 * half_k, 2 * half_n);
+  auto c11 = c.view(0, 0, half_m, half_n);
+  auto c12 = c.view(0, half_n, half_m, 2 * half_n);
+  auto c21 = c.view(half_m, 0, 2 * half_m, half_n);
+  auto c22 = c.view(half_m, half_n, 2 * half_m, 2 * half_n);
+
+  StrassenBuffer<value_type> s1(half_m, half_k), s2(half_m, half_k), s3(half_m, half_k), s4(half_m, half_k);
+  s1.view() = a21 + a22;
+  s2.view() = s1.view() - a11;
+  s3.view() = a11 - a21;
+  s4.view() = a12 - s2.view();
+
+  StrassenBuffer<value_type> t1(half_k, half_n), t2(half_k, half_n), t3(half_k, half_n), t4(half_k, half_n);
+  t1.view() = b12 - b11;
+  t2.view() = b22 - t1.view();
+  t3.view() = b22 - b12;
+  t4.view() = t2.view() - b21;
+
+  std::vector<StrassenBuffer<value_type>> products;
+  products.reserve(7);
+  for (size_t i = 0; i < 7; i++) {
+    products.emplace_back(half_m, half_n);
+  }
+  auto product = [&](size_t index, MatrixView<const value_type> lhs, MatrixView<const value_type> rhs) {
+    strassen_multiply<value_type>(products[index].view(), lhs, rhs, crossover);
+  };
+  product(0, a11, b11);
+  product(1, a12, b21);
+  product(2, s4.view(), b22);
+  product(3, a22, t4.view());
+  product(4, s1.view(), t1.view());
+  product(5, s2.view(), t2.view());
+  product(6, s3.view(), t3.view());
+  const auto &p1 = products[0].view();
+  const auto &p2 = products[1].view();
+  const auto &p3 = products[2].view();
+  const auto &p4 = products[3].view();
+  const auto &p5 = products[4].view();
+  const auto &p6 = products[5].view();
+  const auto &p7 = products[6].view();
+
+  c11 = p1 + p2;
+  p1 += p6;
+  c12 = p1 + p5 + p3;
+  p1 += p7;
+  c21 = p1 - p4;
+  c22 = p1 + p5;
+
+  // Отщеплённые последние строка и столбец
+  if (k % 2 == 1) {
+    multiply_add<T>(c.view(0, 0, 2 * half_m, 2 * half_n),
+                    a.view(0, k - 1, 2 * half_m, k), b.view(k - 1, 0, k, 2 * half_n));
+  }
+  if (n % 2 == 1) {
+    auto last_column = c.view(0, n - 1, 2 * half_m, n);
+    last_column.fill(value_type(0));
+    multiply_add<T>(last_column, a.view(0, 0, 2 * half_m, k), b.view(0, n - 1, k, n));
+  }
+  if (m % 2 == 1) {
+    auto last_line = c.view(m - 1, 0, m, n);
+    last_line.fill(value_type(0));
+    multiply_add<T>(last_line, a.view(m - 1, 0, m, k), b);
+  }
+}
+
+// C = A * B; большие матрицы умножаются по Штрассену-Винограду, если этот режим включён
+template<typename T>
+void multiply(MatrixView<T> c, typename MatrixView<T>::const_view a, typename MatrixView<T>::const_view b) {
+  using value_type = typename MatrixView<T>::value_type;
+  size_t crossover = strassen_crossover();
+  if (crossover != 0 && std::min({a.vertical_size(), a.horizontal_size(), b.horizontal_size()}) >= crossover) {
+    strassen_multiply<T>(c, a, b, crossover);
+  } else {
+    c.fill(value_type(0));
+    multiply_add<T>(c, a, b);
+  }
+}
+
+template<typename T>
+void multiply(MatrixView<T> c, typename MatrixView<T>::const_view a,
+              TransposedMatrixView<const typename MatrixView<T>::value_type> b) {
+  using value_type = typename MatrixView<T>::value_type;
+  c.fill(value_type(0));
+  multiply_add<T>(c, a, b);
+}
+
+#endif //LINEARALG_STRASSEN_H
@@ -0,0 +1,415 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_TEXTFORMAT_H
+#define LINEARALG_TEXTFORMAT_H
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "FixedMatrix.h"
+#include "Matrix.h"
+#include "ModInt.h"
+#include "Permutation.h"
+#include "Polynominal.h"
+#include "Rational.h"
+#include "SparseMatrix.h"
+#include "ThreadPool.h"
+
+// Текстовый формат для всех типов библиотеки. Он совпадает с выводом operator<<, только числа с плавающей точкой
+// пишутся через std::to_chars кратчайшей строкой, которая читается обратно в то же самое число, так что
+// parse_from(format_to(x)) == x точно.
+// format_to дописывает текст в конец buffer: один буфер можно переиспользовать без новых выделений памяти.
+// parse_from читает значение из начала [first, last) и возвращает указатель за прочитанным текстом
+// или nullptr, если текст не разбирается; пробелы и переводы строк между частями пропускаются.
+
+template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>>
+void format_to(std::string &buffer, T value) {
+  char text[64];
+  char *end = std::to_chars(text, text + sizeof(text), value).ptr;
+  buffer.append(text, end);
+}
+
+template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>>
+const char *parse_from(const char *first, const char *last, T &value) {
+  std::from_chars_result result = std::from_chars(first, last, value);
+  return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+inline void format_to(std::string &buffer, const Rational &value) {
+  format_to(buffer, value.numerator());
+  if (value.denominator() != 1) {
+    buffer += '/';
+    format_to(buffer, value.denominator());
+  }
+}
+
+inline const char *parse_from(const char *first, const char *last, Rational &value) {
+  Rational::value_type numerator;
+  Rational::value_type denominator = 1;
+  first = parse_from(first, last, numerator);
+  if (first != nullptr && first != last && *first == '/') {
+    first = parse_from(first + 1, last, denominator);
+    if (denominator == 0) {
+      return nullptr;
+    }
+  }
+  if (first != nullptr) {
+    value = Rational(numerator, denominator);
+  }
+  return first;
+}
+
+template<uint32_t P>
+void format_to(std::string &buffer, ModInt<P> value) {
+  format_to(buffer, value.value());
+}
+
+template<uint32_t P>
+const char *parse_from(const char *first, const char *last, ModInt<P> &value) {
+  uint64_t representative;
+  first = parse_from(first, last, representative);
+  if (first != nullptr) {
+    value = ModInt<P>(static_cast<long long>(representative % P));
+  }
+  return first;
+}
+
+inline const char *skip_spaces(const char *first, const char *last) {
+  while (first != last && (*first == ' ' || *first == '\n' || *first == '\t' || *first == '\r')) {
+    first++;
+  }
+  return first;
+}
+
+// Пропускает пробелы и символ symbol; nullptr, если дальше другой символ
+inline const char *expect_symbol(const char *first, const char *last, char symbol) {
+  if (first == nullptr) {
+    return nullptr;
+  }
+  first = skip_spaces(first, last);
+  if (first == last || *first != symbol) {
+    return nullptr;
+  }
+  return first + 1;
+}
+
+inline bool next_symbol_is(const char *first, const char *last, char symbol) {
+  first = skip_spaces(first, last);
+  return first != last && *first == symbol;
+}
+
+// Одночлены от старшей степени к младшей, как у operator<<: "x^3-9*x^2+1/2*x-18", нулевой многочлен - "0"
+template<typename T>
+void format_to(std::string &buffer, const Polynomial<T> &polynomial) {
+  int degree = polynomial.Degree();
+  if (degree == -1) {
+    buffer += '0';
+    return;
+  }
+  for (int power = degree; power >= 0; power--) {
+    T value = polynomial[power];
+    if (value == T(0)) {
+      continue;
+    }
+    if (!(value < T(0)) && power != degree) {
+      buffer += '+';
+    }
+    bool unit = power != 0 && (value == T(1) || value == T(-1));
+    if (!unit) {
+      format_to(buffer, value);
+      if (power != 0) {
+        buffer += '*';
+      }
+    } else if (value == T(-1)) {
+      buffer += '-';
+    }
+    if (power == 1) {
+      buffer += 'x';
+    } else if (power > 1) {
+      buffer += "x^";
+      format_to(buffer, power);
+    }
+  }
+}
+
+template<typename T>
+const char *parse_from(const char *first, const char *last, Polynomial<T> &polynomial) {
+  std::vector<T> coefficients;
+  bool is_first = true;
+  while (true) {
+    first = skip_spaces(first, last);
+    if (!is_first) {
+      if (first == last || (*first != '+' && *first != '-')) {
+        break;
+      }
+      if (*first == '+') {
+        first++;
+      }
+    }
+    is_first = false;
+
+    // Коэффициенты 1 и -1 перед x не пишутся, остальные сами разбирают свой знак
+    T coefficient = T(1);
+    if (first != last && *first == '-' && first + 1 != last && first[1] == 'x') {
+      coefficient = -T(1);
+      first++;
+    } else if (first == last || *first != 'x') {
+      first = parse_from(first, last, coefficient);
+      if (first == nullptr) {
+        return nullptr;
+      }
+      if (first != last && *first == '*') {
+        first++;
+        if (first == last || *first != 'x') {
+          return nullptr;
+        }
+      }
+    }
+
+    int power = 0;
+    if (first != last && *first == 'x') {
+      first++;
+      power = 1;
+      if (first != last && *first == '^') {
+        first = parse_from(first + 1, last, power);
+        if (first == nullptr || power < 0) {
+          return nullptr;
+        }
+      }
+    }
+    if (coefficients.size() <= static_cast<size_t>(power)) {
+      coefficients.resize(power + 1, T(0));
+    }
+    coefficients[power] += coefficient;
+  }
+  polynomial = coefficients.empty() ? Polynomial<T>() : Polynomial<T>(std::move(coefficients));
+  return first;
+}
+
+// "(2, 0, 1)"
+inline void format_to(std::string &buffer, const Permutation &permutation) {
+  buffer += '(';
+  for (size_t i = 0; i < permutation.size(); i++) {
+    if (i != 0) {
+      buffer += ", ";
+    }
+    format_to(buffer, permutation[i]);
+  }
+  buffer += ')';
+}
+
+// Текст, который не задаёт перестановку, не разбирается
+inline const char *parse_from(const char *first, const char *last, Permutation &permutation) {
+  std::vector<int> data;
+  first = expect_symbol(first, last, '(');
+  if (first != nullptr && !next_symbol_is(first, last, ')')) {
+    do {
+      int value;
+      first = parse_from(skip_spaces(first, last), last, value);
+      if (first == nullptr) {
+        return nullptr;
+      }
+      data.push_back(value);
+    } while (next_symbol_is(first, last, ',') && (first = expect_symbol(first, last, ',')) != nullptr);
+  }
+  first = expect_symbol(first, last, ')');
+  if (first == nullptr) {
+    return nullptr;
+  }
+  std::vector<bool> seen(data.size(), false);
+  for (int value : data) {
+    if (value < 0 || static_cast<size_t>(value) >= data.size() || seen[value]) {
+      return nullptr;
+    }
+    seen[value] = true;
+  }
+  permutation = Permutation(data);
+  return first;
+}
+
+// Строки матрицы с first по last как у operator<<: "(a, b)" через ",\n"
+template<typename T>
+void format_lines(std::string &buffer, MatrixView<const T> view, size_t first, size_t last) {
+  for (size_t i = first; i < last; i++) {
+    if (i != 0) {
+      buffer += ",\n";
+    }
+    buffer += '(';
+    const T *line = view[i];
+    for (size_t j = 0; j < view.horizontal_size(); j++) {
+      if (j != 0) {
+        buffer += ", ";
+      }
+      format_to(buffer, line[j]);
+    }
+    buffer += ')';
+  }
+}
+
+// "((1, 2),\n(3, 4))". Большие матрицы потоки пишут полосами строк в свои буферы, которые затем склеиваются
+template<typename T>
+void format_to(std::string &buffer, MatrixView<const T> view) {
+  buffer += '(';
+  size_t lines = view.vertical_size();
+  if (lines * view.horizontal_size() < 1 << 16) {
+    format_lines(buffer, view, 0, lines);
+  } else {
+    size_t grain = std::max<size_t>(1, (1 << 14) / std::max<size_t>(1, view.horizontal_size()));
+    size_t chunks = (lines + grain - 1) / grain;
+    std::vector<std::string> parts(chunks);
+    parallel_for(0, chunks, 1, [&](size_t first, size_t last) {
+      for (size_t chunk = first; chunk < last; chunk++) {
+        format_lines(parts[chunk], view, chunk * grain, std::min(lines, (chunk + 1) * grain));
+      }
+    });
+    for (const std::string &part : parts) {
+      buffer += part;
+    }
+  }
+  buffer += ')';
+}
+
+template<typename T>
+void format_to(std::string &buffer, MatrixView<T> view) {
+  format_to(buffer, MatrixView<const T>(view));
+}
+
+template<typename T>
+void format_to(std::string &buffer, const Matrix<T> &matrix) {
+  format_to(buffer, matrix.view());
+}
+
+// Все строки должны быть одной длины, пустая матрица - "()"
+template<typename T>
+const char *parse_from(const char *first, const char *last, Matrix<T> &matrix) {
+  std::vector<T> elements;
+  size_t lines = 0;
+  size_t width = 0;
+  first = expect_symbol(first, last, '(');
+  if (first != nullptr && !next_symbol_is(first, last, ')')) {
+    do {
+      first = expect_symbol(first, last, '(');
+      if (first == nullptr) {
+        return nullptr;
+      }
+      size_t line_width = 0;
+      if (!next_symbol_is(first, last, ')')) {
+        do {
+          elements.emplace_back();
+          first = parse_from(skip_spaces(first, last), last, elements.back());
+          if (first == nullptr) {
+            return nullptr;
+          }
+          line_width++;
+        } while (next_symbol_is(first, last, ',') && (first = expect_symbol(first, last, ',')) != nullptr);
+      }
+      first = expect_symbol(first, last, ')');
+      if (first == nullptr || (lines != 0 && line_width != width)) {
+        return nullptr;
+      }
+      width = line_width;
+      lines++;
+    } while (next_symbol_is(first, last, ',') && (first = expect_symbol(first, last, ',')) != nullptr);
+  }
+  first = expect_symbol(first, last, ')');
+  if (first == nullptr) {
+    return nullptr;
+  }
+  matrix = Matrix<T>(width, lines);
+  std::copy(elements.begin(), elements.end(), matrix.data());
+  return first;
+}
+
+template<typename T, size_t R, size_t C>
+void format_to(std::string &buffer, const FixedMatrix<T, R, C> &matrix) {
+  format_to(buffer, matrix.view());
+}
+
+// Размеры задаёт тип, текст с другими размерами не разбирается
+template<typename T, size_t R, size_t C>
+const char *parse_from(const char *first, const char *last, FixedMatrix<T, R, C> &matrix) {
+  Matrix<T> dense;
+  first = parse_from(first, last, dense);
+  if (first == nullptr || dense.vertical_size() != R || dense.horizontal_size() != C) {
+    return nullptr;
+  }
+  matrix = FixedMatrix<T, R, C>(dense);
+  return first;
+}
+
+// Ненулевые элементы по строкам как у operator<<: "((0, 1): 5, (2, 0): -3)". Размеры в текст не входят
+template<typename T>
+void format_to(std::string &buffer, const SparseMatrix<T> &matrix) {
+  buffer += '(';
+  for (size_t i = 0; i < matrix.vertical_size(); i++) {
+    for (size_t p = matrix.row_offsets()[i]; p < matrix.row_offsets()[i + 1]; p++) {
+      if (p != 0) {
+        buffer += ", ";
+      }
+      buffer += '(';
+      format_to(buffer, i);
+      buffer += ", ";
+      format_to(buffer, matrix.column_indices()[p]);
+      buffer += "): ";
+      format_to(buffer, matrix.values()[p]);
+    }
+  }
+  buffer += ')';
+}
+
+// Размеры берутся из matrix, позиции за её пределами не разбираются. Повторяющиеся позиции складываются,
+// как в конструкторе из списка элементов
+template<typename T>
+const char *parse_from(const char *first, const char *last, SparseMatrix<T> &matrix) {
+  std::vector<SparseEntry<T>> entries;
+  first = expect_symbol(first, last, '(');
+  if (first != nullptr && !next_symbol_is(first, last, ')')) {
+    do {
+      SparseEntry<T> entry{};
+      first = expect_symbol(first, last, '(');
+      if (first != nullptr) {
+        first = parse_from(skip_spaces(first, last), last, entry.row);
+      }
+      first = expect_symbol(first, last, ',');
+      if (first != nullptr) {
+        first = parse_from(skip_spaces(first, last), last, entry.column);
+      }
+      first = expect_symbol(expect_symbol(first, last, ')'), last, ':');
+      if (first != nullptr) {
+        first = parse_from(skip_spaces(first, last), last, entry.value);
+      }
+      if (first == nullptr || entry.row >= matrix.vertical_size() || entry.column >= matrix.horizontal_size()) {
+        return nullptr;
+      }
+      entries.push_back(std::move(entry));
+    } while (next_symbol_is(first, last, ',') && (first = expect_symbol(first, last, ',')) != nullptr);
+  }
+  first = expect_symbol(first, last, ')');
+  if (first == nullptr) {
+    return nullptr;
+  }
+  matrix = SparseMatrix<T>(matrix.horizontal_size(), matrix.vertical_size(), std::move(entries));
+  return first;
+}
+
+template<typename T>
+std::string to_text(const T &value) {
+  std::string buffer;
+  format_to(buffer, value);
+  return buffer;
+}
+
+// Текст должен содержать ровно одно значение, не считая пробелов по краям
+template<typename T>
+bool from_text(std::string_view text, T &value) {
+  const char *last = text.data() + text.size();
+  const char *end = parse_from(skip_spaces(text.data(), last), last, value);
+  return end != nullptr && skip_spaces(end, last) == last;
+}
+
+#endif //LINEARALG_TEXTFORMAT_H
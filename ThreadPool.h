@@ -0,0 +1,187 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_THREADPOOL_H
+#define LINEARALG_THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t thread_count) {
+    for (size_t i = 1; i < thread_count; i++) {
+      workers_.emplace_back([this] {
+        work();
+      });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    job_ready_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Вызывающий поток тоже участвует в работе
+  size_t thread_count() const {
+    return workers_.size() + 1;
+  }
+
+  // Вызывает function(chunk_begin, chunk_end) для кусков [begin, end) длины grain и ждёт их завершения.
+  // Потоки разбирают куски по одному, так что неравномерная нагрузка балансируется сама.
+  // Каждый индекс обрабатывается ровно одним вызовом, поэтому результат не зависит от числа потоков,
+  // если куски не пишут в общие данные. Вложенные вызовы выполняются последовательно.
+  template<typename Function>
+  void parallel_for(size_t begin, size_t end, size_t grain, const Function &function) {
+    grain = std::max<size_t>(grain, 1);
+    if (begin >= end) {
+      return;
+    }
+    if (workers_.empty() || end - begin <= grain || inside_pool()) {
+      function(begin, end);
+      return;
+    }
+
+    std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+    std::atomic<size_t> next(begin);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    std::function<void()> job = [&] {
+      try {
+        for (size_t chunk_begin = next.fetch_add(grain); chunk_begin < end; chunk_begin = next.fetch_add(grain)) {
+          function(chunk_begin, std::min(end, chunk_begin + grain));
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = end;
+      }
+    };
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      pending_ = workers_.size();
+      generation_++;
+    }
+    job_ready_.notify_all();
+
+    inside_pool() = true;
+    job();
+    inside_pool() = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_done_.wait(lock, [this] {
+      return pending_ == 0;
+    });
+    job_ = nullptr;
+    lock.unlock();
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  std::vector<std::thread> workers_;
+  std::mutex submit_mutex_;
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+  std::function<void()> *job_ = nullptr;
+  size_t pending_ = 0;
+  size_t generation_ = 0;
+  bool stopping_ = false;
+
+  static bool &inside_pool() {
+    thread_local bool inside = false;
+    return inside;
+  }
+
+  void work() {
+    inside_pool() = true;
+    size_t seen_generation = 0;
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_ready_.wait(lock, [&] {
+        return stopping_ || generation_ != seen_generation;
+      });
+      if (stopping_) {
+        return;
+      }
+      seen_generation = generation_;
+      std::function<void()> *job = job_;
+      lock.unlock();
+
+      (*job)();
+
+      lock.lock();
+      if (--pending_ == 0) {
+        job_done_.notify_all();
+      }
+    }
+  }
+};
+
+// Пул, которым пользуются операции Matrix. По умолчанию всё выполняется в одном потоке.
+
+inline std::mutex &global_thread_pool_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+inline std::shared_ptr<ThreadPool> &global_thread_pool() {
+  static std::shared_ptr<ThreadPool> pool;
+  return pool;
+}
+
+// Не стоит вызывать одновременно с работающими операциями: они доработают на старом пуле
+inline void set_thread_count(size_t thread_count) {
+  std::lock_guard<std::mutex> lock(global_thread_pool_mutex());
+  if (thread_count <= 1) {
+    global_thread_pool().reset();
+  } else {
+    global_thread_pool() = std::make_shared<ThreadPool>(thread_count);
+  }
+}
+
+inline size_t thread_count() {
+  std::lock_guard<std::mutex> lock(global_thread_pool_mutex());
+  return global_thread_pool() ? global_thread_pool()->thread_count() : 1;
+}
+
+template<typename Function>
+void parallel_for(size_t begin, size_t end, size_t grain, const Function &function) {
+  std::shared_ptr<ThreadPool> pool;
+  {
+    std::lock_guard<std::mutex> lock(global_thread_pool_mutex());
+    pool = global_thread_pool();
+  }
+  if (pool) {
+    pool->parallel_for(begin, end, grain, function);
+  } else if (begin < end) {
+    function(begin, end);
+  }
+}
+
+#endif //LINEARALG_THREADPOOL_H
@@ -0,0 +1,79 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_TRANSPOSE_H
+#define LINEARALG_TRANSPOSE_H
+
+#include <algorithm>
+#include "MatrixView.h"
+
+// Транспонирование делит блоки пополам по большей стороне, пока они не станут меньше этого размера.
+// Такое разбиение не зависит от размеров кэшей и TLB и одинаково хорошо работает на всех уровнях.
+constexpr size_t TRANSPOSE_BLOCK_SIZE = 32;
+
+// destination = source^T, блоки не должны пересекаться
+template<typename T>
+void transpose_into(typename MatrixView<T>::const_view source, MatrixView<T> destination) {
+  size_t rows = source.vertical_size();
+  size_t columns = source.horizontal_size();
+  if (rows <= TRANSPOSE_BLOCK_SIZE && columns <= TRANSPOSE_BLOCK_SIZE) {
+    for (size_t i = 0; i < rows; i++) {
+      const T *source_line = source[i];
+      for (size_t j = 0; j < columns; j++) {
+        destination(j, i) = source_line[j];
+      }
+    }
+  } else if (rows >= columns) {
+    size_t middle = rows / 2;
+    transpose_into<T>(source.view(0, 0, middle, columns), destination.view(0, 0, columns, middle));
+    transpose_into<T>(source.view(middle, 0, rows, columns), destination.view(0, middle, columns, rows));
+  } else {
+    size_t middle = columns / 2;
+    transpose_into<T>(source.view(0, 0, rows, middle), destination.view(0, 0, middle, rows));
+    transpose_into<T>(source.view(0, middle, rows, columns), destination.view(middle, 0, columns, rows));
+  }
+}
+
+// Меняет местами first(i, j) и second(j, i)
+template<typename T>
+void swap_transposed(MatrixView<T> first, MatrixView<T> second) {
+  size_t rows = first.vertical_size();
+  size_t columns = first.horizontal_size();
+  if (rows <= TRANSPOSE_BLOCK_SIZE && columns <= TRANSPOSE_BLOCK_SIZE) {
+    for (size_t i = 0; i < rows; i++) {
+      T *first_line = first[i];
+      for (size_t j = 0; j < columns; j++) {
+        std::swap(first_line[j], second(j, i));
+      }
+    }
+  } else if (rows >= columns) {
+    size_t middle = rows / 2;
+    swap_transposed(first.view(0, 0, middle, columns), second.view(0, 0, columns, middle));
+    swap_transposed(first.view(middle, 0, rows, columns), second.view(0, middle, columns, rows));
+  } else {
+    size_t middle = columns / 2;
+    swap_transposed(first.view(0, 0, rows, middle), second.view(0, 0, middle, rows));
+    swap_transposed(first.view(0, middle, rows, columns), second.view(middle, 0, columns, rows));
+  }
+}
+
+// Транспонирует квадратный блок на месте
+template<typename T>
+void transpose_square(MatrixView<T> square) {
+  size_t size = square.vertical_size();
+  if (size <= TRANSPOSE_BLOCK_SIZE) {
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = i + 1; j < size; j++) {
+        std::swap(square(i, j), square(j, i));
+      }
+    }
+    return;
+  }
+  size_t middle = size / 2;
+  transpose_square(square.view(0, 0, middle, middle));
+  transpose_square(square.view(middle, middle, size, size));
+  swap_transposed(square.view(0, middle, middle, size), square.view(middle, 0, size, middle));
+}
+
+#endif //LINEARALG_TRANSPOSE_H
@@ -5,4 +5,25 @@
 #ifndef LINEARALG_UTILS_H
 #define LINEARALG_UTILS_H
 
+#include <type_traits>
+
+template<typename T>
+constexpr T my_abs(T value) {
+  if (value < 0) {
+    return -value;
+  }
+  return value;
+}
+
+// Тип, в котором произведение двух T не переполняется: для встроенных целых - вдвое шире
+template<typename T, typename = void>
+struct WideProduct {
+  using type = T;
+};
+
+template<typename T>
+struct WideProduct<T, std::enable_if_t<std::is_integral<T>::value && sizeof(T) <= 8>> {
+  using type = std::conditional_t<std::is_signed<T>::value, __int128, unsigned __int128>;
+};
+
 #endif //LINEARALG_UTILS_H
@@ -0,0 +1,79 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+Matrix<long long> power_in_scope(const Matrix<long long> &x, int power) {
+  ArenaScope scope;
+  Matrix<long long> result = Identity<long long>(x.vertical_size());
+  for (int i = 0; i < power; i++) {
+    result = result * x;
+  }
+  return result;
+}
+
+int main() {
+  Matrix<long long> x = random_matrix<long long>(6, 6, -3, 3, 1);
+  Matrix<long long> expected = Identity<long long>(6);
+  for (int i = 0; i < 5; i++) {
+    expected = naive_product(expected, x);
+  }
+
+  // Результат живёт во внешней области, а временные произведения - во вложенной
+  {
+    ArenaScope outer;
+    Matrix<long long> accumulator = Identity<long long>(6);
+    {
+      ArenaScope inner;
+      for (int i = 0; i < 5; i++) {
+        accumulator = accumulator * x;
+      }
+    }
+    // Новые выделения во внешней области ложатся туда, где была вложенная, и накрывают её целиком
+    Matrix<long long> garbage = random_matrix<long long>(50, 50, 100, 200, 2);
+    CHECK(equal(accumulator, expected));
+  }
+
+  {
+    ArenaScope outer;
+    Polynomial<long long> accumulator({1});
+    Polynomial<long long> factor({1, 1});
+    {
+      ArenaScope inner;
+      for (int i = 0; i < 4; i++) {
+        accumulator = accumulator * factor;
+      }
+    }
+    Polynomial<long long> garbage(std::vector<long long>(2000, 7));
+    CHECK(accumulator == Polynomial<long long>({1, 4, 6, 4, 1}));
+  }
+
+  // Значение, возвращённое из области, не должно быть затёрто следующими выделениями
+  {
+    ArenaScope outer;
+    Matrix<long long> escaped = power_in_scope(x, 5);
+    Matrix<long long> garbage = random_matrix<long long>(50, 50, 100, 200, 3);
+    CHECK(equal(escaped, expected));
+  }
+  Matrix<long long> escaped = power_in_scope(x, 5);
+  {
+    ArenaScope scope;
+    Matrix<long long> garbage = random_matrix<long long>(50, 50, 100, 200, 4);
+    CHECK(equal(escaped, expected));
+  }
+
+  // Без вынесенных значений память арены переиспользуется
+  const long long *first_data;
+  {
+    ArenaScope scope;
+    Matrix<long long> temporary = x * x;
+    first_data = temporary.data();
+  }
+  {
+    ArenaScope scope;
+    Matrix<long long> temporary = x * x;
+    CHECK(temporary.data() == first_data);
+  }
+  return check_result();
+}
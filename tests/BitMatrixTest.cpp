@@ -0,0 +1,109 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../BitMatrix.h"
+
+Matrix<int> random_bits(size_t vertical_size, size_t horizontal_size, unsigned seed) {
+  return random_matrix<int>(vertical_size, horizontal_size, 0, 1, seed);
+}
+
+Matrix<int> reduce(Matrix<int> a) {
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      a[i][j] &= 1;
+    }
+  }
+  return a;
+}
+
+// Улучшенный ступенчатый вид над GF(2) по определению; он единственный, так что с ним можно сравнивать точно
+Matrix<int> naive_gauss(Matrix<int> a, std::vector<size_t> &pivots) {
+  pivots.clear();
+  size_t row = 0;
+  for (size_t column = 0; column < a.horizontal_size() && row < a.vertical_size(); column++) {
+    size_t pivot = row;
+    while (pivot < a.vertical_size() && a[pivot][column] == 0) {
+      pivot++;
+    }
+    if (pivot == a.vertical_size()) {
+      continue;
+    }
+    a.view().swap_lines(row, pivot);
+    for (size_t i = 0; i < a.vertical_size(); i++) {
+      if (i != row && a[i][column] == 1) {
+        for (size_t j = 0; j < a.horizontal_size(); j++) {
+          a[i][j] ^= a[row][j];
+        }
+      }
+    }
+    pivots.push_back(column);
+    row++;
+  }
+  return a;
+}
+
+std::vector<bool> random_bit_vector(size_t size, unsigned seed) {
+  Matrix<int> bits = random_bits(size, 1, seed);
+  std::vector<bool> result(size);
+  for (size_t i = 0; i < size; i++) {
+    result[i] = bits[i][0] == 1;
+  }
+  return result;
+}
+
+int main() {
+  // Размеры вокруг границ слов и полос таблиц
+  for (size_t n : {1, 7, 63, 64, 65, 130, 257}) {
+    Matrix<int> a = random_bits(n, n + 3, unsigned(n));
+    Matrix<int> b = random_bits(n + 3, n / 2 + 1, unsigned(n + 1));
+    BitMatrix bit_a(a), bit_b(b);
+    CHECK(equal(bit_a.dense(), a));
+    CHECK(equal((bit_a * bit_b).dense(), reduce(naive_product(a, b))));
+    CHECK(equal((bit_a + bit_a).dense(), Matrix<int>(n + 3, n)));
+
+    std::vector<size_t> pivots;
+    Matrix<int> reduced = naive_gauss(a, pivots);
+    CHECK(equal(bit_a.gauss().dense(), reduced));
+    CHECK(bit_a.pivot_columns() == pivots && bit_a.rank() == pivots.size());
+    BitMatrix echelon = bit_a;
+    CHECK(echelon.make_row_echelon() == pivots);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < (i < pivots.size() ? pivots[i] : n + 3); j++) {
+        CHECK(!echelon(i, j));
+      }
+    }
+
+    // Совместная система: b = A x для случайного x
+    std::vector<bool> x = random_bit_vector(n + 3, unsigned(n + 2));
+    std::vector<bool> rhs = bit_a * x;
+    std::vector<bool> solution = bit_a.solve(rhs);
+    CHECK(solution.size() == n + 3 && bit_a * solution == rhs);
+  }
+
+  // Ранг произведения m x r и r x n - r, если сомножители полного ранга
+  Matrix<int> left = random_bits(300, 40, 10);
+  Matrix<int> right = random_bits(40, 200, 11);
+  BitMatrix low_rank = BitMatrix(left) * BitMatrix(right);
+  std::vector<size_t> pivots;
+  naive_gauss(reduce(naive_product(left, right)), pivots);
+  CHECK(low_rank.rank() == pivots.size());
+  CHECK(BitMatrix(left).rank() == 40 && pivots.size() == 40);
+
+  // Обратная матрица и несовместная система
+  for (unsigned seed = 20; seed < 30; seed++) {
+    BitMatrix square(random_bits(90, 90, seed));
+    BitMatrix inverse = square.inversed();
+    if (square.rank() == 90) {
+      CHECK(square * inverse == BitMatrix::identity(90) && inverse * square == BitMatrix::identity(90));
+    } else {
+      CHECK(inverse.empty());
+    }
+  }
+  BitMatrix singular(Matrix<int>({{1, 1, 0}, {0, 1, 1}, {1, 0, 1}}));
+  CHECK(singular.rank() == 2 && singular.inversed().empty());
+  CHECK(singular.solve({true, false, false}).empty());
+  CHECK(singular * singular.solve({true, true, false}) == std::vector<bool>({true, true, false}));
+  return check_result();
+}
@@ -0,0 +1,60 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../ModInt.h"
+#include "../Rational.h"
+
+// p(A) по схеме Горнера
+template<typename T>
+Matrix<T> evaluate_at(const Polynomial<T> &polynomial, const Matrix<T> &a) {
+  size_t n = a.vertical_size();
+  Matrix<T> result(n, n);
+  for (int degree = polynomial.Degree(); degree >= 0; degree--) {
+    result = naive_product(result, a);
+    for (size_t i = 0; i < n; i++) {
+      result[i][i] += polynomial[degree];
+    }
+  }
+  return result;
+}
+
+int main() {
+  for (size_t n : {1, 2, 3, 5, 6}) {
+    Matrix<long long> a = random_matrix<long long>(n, n, -9, 9, n);
+    Polynomial<long long> polynomial = a.characteristic_polynomial();
+    CHECK(polynomial == a.slow_characteristic_polynomial());
+    CHECK(polynomial.Degree() == int(n) && polynomial[n] == 1);
+    CHECK(equal(evaluate_at(polynomial, a), Matrix<long long>(n, n)));
+
+    Matrix<Rational> exact = random_matrix<Rational>(n, n, -9, 9, n);
+    exact[0][0] = Rational(1, 3);
+    CHECK(exact.characteristic_polynomial() == exact.slow_characteristic_polynomial());
+  }
+
+  // Теорема Гамильтона-Кэли на большой матрице над полем вычетов
+  using Field = ModInt<998244353>;
+  Matrix<Field> modular = random_matrix<Field>(40, 40, 0, 1000, 7);
+  CHECK(equal(evaluate_at(modular.characteristic_polynomial(), modular), Matrix<Field>(40, 40)));
+
+  // Хессенберг для double: коэффициенты при lambda^(n-1) и lambda^0 - это -tr A и (-1)^n det A
+  for (size_t n : {4, 16, 50}) {
+    Matrix<double> a = random_real_matrix<double>(n, n, n);
+    Polynomial<double> hessenberg = a.characteristic_polynomial();
+    CHECK(hessenberg.Degree() == int(n));
+    double trace = 0;
+    for (size_t i = 0; i < n; i++) {
+      trace += a[i][i];
+    }
+    CHECK(std::abs(hessenberg[n - 1] + trace) < 1e-10 * n);
+    CHECK(std::abs(hessenberg[0] - (n % 2 ? -1 : 1) * a.determinant()) < 1e-9 * (1 + std::abs(hessenberg[0])));
+  }
+  Matrix<double> small = random_real_matrix<double>(6, 6, 3);
+  Polynomial<double> hessenberg = small.characteristic_polynomial();
+  Polynomial<double> slow = small.slow_characteristic_polynomial();
+  for (size_t degree = 0; degree <= 6; degree++) {
+    CHECK(std::abs(hessenberg[degree] - slow[degree]) < 1e-12);
+  }
+  return check_result();
+}
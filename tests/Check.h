@@ -0,0 +1,145 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#ifndef LINEARALG_CHECK_H
+#define LINEARALG_CHECK_H
+
+// Каждый тест - отдельная программа без зависимостей, которая возвращает ненулевой код при ошибке:
+//   g++ -std=c++17 -O2 -pthread -I.. StorageTest.cpp && ./a.out
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../Matrix.h"
+
+inline int &check_failures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      check_failures()++; \
+    } \
+  } while (false)
+
+inline int check_result() {
+  if (check_failures() != 0) {
+    std::fprintf(stderr, "%d checks failed\n", check_failures());
+  }
+  return check_failures() == 0 ? 0 : 1;
+}
+
+// Случайная матрица с целыми элементами из [low, high], приведёнными к T
+template<typename T>
+Matrix<T> random_matrix(size_t vertical_size, size_t horizontal_size, int low, int high, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> distribution(low, high);
+  Matrix<T> result(horizontal_size, vertical_size);
+  for (size_t i = 0; i < vertical_size; i++) {
+    for (size_t j = 0; j < horizontal_size; j++) {
+      result[i][j] = T(distribution(generator));
+    }
+  }
+  return result;
+}
+
+template<typename T>
+Matrix<T> random_real_matrix(size_t vertical_size, size_t horizontal_size, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(-1, 1);
+  Matrix<T> result(horizontal_size, vertical_size);
+  for (size_t i = 0; i < vertical_size; i++) {
+    for (size_t j = 0; j < horizontal_size; j++) {
+      result[i][j] = T(distribution(generator));
+    }
+  }
+  return result;
+}
+
+// Столбец random_real_matrix в виде вектора
+inline std::vector<double> random_vector(size_t n, unsigned seed) {
+  Matrix<double> column = random_real_matrix<double>(n, 1, seed);
+  std::vector<double> result(n);
+  for (size_t i = 0; i < n; i++) {
+    result[i] = column[i][0];
+  }
+  return result;
+}
+
+// Произведение по определению, за O(n^3) без блоков и потоков
+template<typename T>
+Matrix<T> naive_product(const Matrix<T> &a, const Matrix<T> &b) {
+  Matrix<T> result(b.horizontal_size(), a.vertical_size());
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t k = 0; k < a.horizontal_size(); k++) {
+      for (size_t j = 0; j < b.horizontal_size(); j++) {
+        result[i][j] += a[i][k] * b[k][j];
+      }
+    }
+  }
+  return result;
+}
+
+template<typename T>
+bool equal(const Matrix<T> &a, const Matrix<T> &b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      if (!(a[i][j] == b[i][j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// max |a_ij - b_ij|, бесконечность при разных размерах
+template<typename T>
+double max_difference(const Matrix<T> &a, const Matrix<T> &b) {
+  if (a.size() != b.size()) {
+    return INFINITY;
+  }
+  double result = 0;
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      result = std::max(result, static_cast<double>(std::abs(a[i][j] - b[i][j])));
+    }
+  }
+  return result;
+}
+
+template<typename T>
+double max_difference(const std::vector<T> &a, const std::vector<T> &b) {
+  if (a.size() != b.size()) {
+    return INFINITY;
+  }
+  double result = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    result = std::max(result, static_cast<double>(std::abs(a[i] - b[i])));
+  }
+  return result;
+}
+
+// max |(A x - b)_i|
+template<typename T>
+double residual(const Matrix<T> &a, const std::vector<T> &x, const std::vector<T> &b) {
+  double result = 0;
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    T sum = -b[i];
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      sum += a[i][j] * x[j];
+    }
+    result = std::max(result, static_cast<double>(std::abs(sum)));
+  }
+  return result;
+}
+
+#endif //LINEARALG_CHECK_H
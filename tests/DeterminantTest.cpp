@@ -0,0 +1,47 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../MultiModular.h"
+#include "../Rational.h"
+
+int main() {
+  // A = L U, L - нижняя унитреугольная, диагональ U даёт det = 10^11.
+  // Миноры помещаются в long long, а их попарные произведения - нет
+  size_t n = 6;
+  Matrix<long long> lower = random_matrix<long long>(n, n, -60, 60, 1);
+  Matrix<long long> upper = random_matrix<long long>(n, n, -60, 60, 2);
+  long long diagonal[] = {10, 100, 1000, 100, 10, 100};
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i; j < n; j++) {
+      lower[i][j] = i == j;
+      upper[j][i] = i == j ? diagonal[i] : 0;
+    }
+  }
+  Matrix<long long> a = naive_product(lower, upper);
+  CHECK(a.determinant() == 100000000000LL);
+  a.view().swap_lines(0, 3);
+  CHECK(a.determinant() == -100000000000LL);
+
+  CHECK(multimodular_determinant(a) == -100000000000LL);
+
+  Matrix<Rational> exact{{Rational(1, 2), Rational(1, 3), 1},
+                         {Rational(2, 3), 0, Rational(-1, 4)},
+                         {1, Rational(5, 6), Rational(1, 5)}};
+  CHECK(exact.determinant() == Rational(383, 720));
+
+  for (unsigned seed = 0; seed < 20; seed++) {
+    Matrix<long long> b = random_matrix<long long>(10, 10, -10, 10, seed);
+    Matrix<double> real = random_matrix<double>(10, 10, -10, 10, seed);
+    long long expected = std::llround(real.determinant());
+    CHECK(b.determinant() == expected);
+    CHECK(multimodular_determinant(b) == expected);
+  }
+
+  Matrix<int> zero_pivot{{0, 1, 2}, {0, 3, 4}, {5, 6, 7}};
+  CHECK(zero_pivot.determinant() == -10);
+  Matrix<int> singular{{1, 2, 3}, {2, 4, 6}, {1, 1, 1}};
+  CHECK(singular.determinant() == 0);
+  return check_result();
+}
@@ -0,0 +1,39 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../Rational.h"
+
+int main() {
+  Matrix<int> a{{1, 2}, {3, 4}};
+  Matrix<int> b{{5, 6}, {7, 8}};
+  Matrix<int> c{{1, 1}, {1, 1}};
+
+  Matrix<int> sum = a + b * 2 - c;
+  CHECK(equal(sum, Matrix<int>{{10, 13}, {16, 19}}));
+  CHECK(equal(Matrix<int>(-a), Matrix<int>{{-1, -2}, {-3, -4}}));
+  CHECK(equal((a - b).eval(), Matrix<int>{{-4, -4}, {-4, -4}}));
+
+  // Матрица может участвовать в выражении, которое ей же присваивается
+  Matrix<int> accumulator = a;
+  accumulator = accumulator + a * 3;
+  CHECK(equal(accumulator, Matrix<int>{{4, 8}, {12, 16}}));
+  accumulator += b - c;
+  CHECK(equal(accumulator, Matrix<int>{{8, 13}, {18, 23}}));
+  accumulator -= a + a;
+  CHECK(equal(accumulator, Matrix<int>{{6, 9}, {12, 15}}));
+
+  // Присваивание выражения другого размера заменяет матрицу
+  Matrix<int> small{{1}};
+  small = a + b;
+  CHECK(equal(small, Matrix<int>{{6, 8}, {10, 12}}));
+
+  // Произведение выражений вычисляет операнды
+  CHECK(equal(Matrix<int>((a + c) * (b - c)), Matrix<int>{{26, 31}, {46, 55}}));
+
+  Matrix<Rational> r{{Rational(1, 2), Rational(1, 3)}};
+  Matrix<Rational> half = r * Rational(1, 2) + r;
+  CHECK(half[0][0] == Rational(3, 4) && half[0][1] == Rational(1, 2));
+  return check_result();
+}
@@ -0,0 +1,92 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../FixedMatrix.h"
+#include "../Rational.h"
+
+constexpr FixedMatrix<int, 3, 3> ROTATION{{0, -1, 0}, {1, 0, 0}, {0, 0, 1}};
+static_assert(ROTATION.determinant() == 1, "determinant is computed at compile time");
+static_assert(ROTATION * ROTATION.transposed() == FixedIdentity<int, 3>(), "rotation is orthogonal");
+
+template<typename T, size_t R, size_t C>
+FixedMatrix<T, R, C> random_fixed(int low, int high, unsigned seed) {
+  return FixedMatrix<T, R, C>(random_matrix<T>(R, C, low, high, seed));
+}
+
+template<size_t N>
+void check_square(unsigned seed) {
+  auto a = random_fixed<long long, N, N>(-9, 9, seed);
+  CHECK(a.determinant() == Matrix<long long>(a).determinant());
+
+  auto exact = random_fixed<Rational, N, N>(-9, 9, seed);
+  auto inverse = exact.inversed();
+  if (exact.determinant() != Rational(0)) {
+    CHECK((exact * inverse == FixedIdentity<Rational, N>()));
+    CHECK(inverse.determinant() * exact.determinant() == Rational(1));
+  }
+
+  auto real = FixedMatrix<double, N, N>(random_real_matrix<double>(N, N, seed));
+  CHECK(max_difference(Matrix<double>(real * real.inversed()), Identity<double>(N)) < 1e-10);
+  CHECK(std::abs(real.determinant() - Matrix<double>(real).determinant()) < 1e-12);
+
+  // Пачка из числа матриц, не кратного числу дорожек
+  std::vector<FixedMatrix<double, N, N>> matrices, others;
+  for (unsigned index = 0; index < 37; index++) {
+    matrices.push_back(FixedMatrix<double, N, N>(random_real_matrix<double>(N, N, seed * 100 + index)));
+    others.push_back(FixedMatrix<double, N, N>(random_real_matrix<double>(N, N, seed * 200 + index)));
+  }
+  FixedMatrixBatch<double, N, N> batch(matrices);
+  FixedMatrixBatch<double, N, N> products = batch * FixedMatrixBatch<double, N, N>(others);
+  FixedMatrixBatch<double, N, N> inverses = batch.inversed();
+  std::vector<double> determinants = batch.determinants();
+  CHECK(determinants.size() == 37 && products.size() == 37);
+  for (size_t index = 0; index < 37; index++) {
+    CHECK(max_difference(Matrix<double>(products[index]), Matrix<double>(matrices[index] * others[index])) < 1e-14);
+    CHECK(max_difference(Matrix<double>(inverses[index]), Matrix<double>(matrices[index].inversed())) < 1e-9);
+    CHECK(std::abs(determinants[index] - matrices[index].determinant()) < 1e-12);
+  }
+}
+
+// Пачка и одиночная матрица обращаются одинаково и для точных типов: целые делятся с отбрасыванием остатка
+template<typename T, size_t N>
+void check_exact_batch(unsigned seed) {
+  std::vector<FixedMatrix<T, N, N>> matrices;
+  for (unsigned index = 0; index < 21; index++) {
+    matrices.push_back(FixedMatrix<T, N, N>(random_matrix<T>(N, N, -3, 3, seed * 100 + index)));
+  }
+  FixedMatrixBatch<T, N, N> inverses = FixedMatrixBatch<T, N, N>(matrices).inversed();
+  for (size_t index = 0; index < matrices.size(); index++) {
+    CHECK(inverses[index] == matrices[index].inversed());
+  }
+}
+
+int main() {
+  check_exact_batch<long long, 2>(7);
+  check_exact_batch<long long, 3>(8);
+  check_exact_batch<int, 4>(9);
+  check_exact_batch<Rational, 3>(10);
+  FixedMatrix<int, 2, 2> triangular{{1, 1}, {0, 2}};
+  FixedMatrixBatch<int, 2, 2> triangular_batch(std::vector<FixedMatrix<int, 2, 2>>{triangular});
+  CHECK((triangular.inversed() == FixedMatrix<int, 2, 2>{{1, 0}, {0, 0}}));
+  CHECK(triangular_batch.inversed()[0] == triangular.inversed());
+
+  check_square<1>(1);
+  check_square<2>(2);
+  check_square<3>(3);
+  check_square<4>(4);
+  check_square<5>(5);
+  check_square<6>(6);
+
+  FixedMatrix<int, 2, 3> a{{1, 2, 3}, {4, 5, 6}};
+  FixedMatrix<int, 3, 2> b{{1, 0}, {0, 1}, {1, 1}};
+  CHECK((a * b == FixedMatrix<int, 2, 2>{{4, 5}, {10, 11}}));
+  CHECK((a + a - a * 2 == FixedMatrix<int, 2, 3>()));
+  CHECK(equal(Matrix<int>(a.transposed()), Matrix<int>(a).transposed()));
+
+  FixedMatrix<double, 3, 3> singular{{1, 2, 3}, {2, 4, 6}, {0, 1, 1}};
+  CHECK(singular.determinant() == 0);
+  CHECK(singular.inversed() == (FixedMatrix<double, 3, 3>()));
+  return check_result();
+}
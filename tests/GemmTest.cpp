@@ -0,0 +1,46 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+template<typename T>
+void check_sizes(double tolerance) {
+  unsigned seed = 1;
+  for (size_t m : {1, 5, 13, 80}) {
+    for (size_t k : {1, 7, 300}) {
+      for (size_t n : {1, 9, 70}) {
+        Matrix<T> a = random_matrix<T>(m, k, -9, 9, seed++);
+        Matrix<T> b = random_matrix<T>(k, n, -9, 9, seed++);
+        Matrix<T> expected = naive_product(a, b);
+        Matrix<T> product = a;
+        product *= b;
+        CHECK(max_difference(product, expected) <= tolerance);
+
+        // B^T вместо B и C -= A B поверх уже заполненного C
+        Matrix<T> bt = b.transposed();
+        Matrix<T> c = expected;
+        gemm(m, n, k, a.data(), a.stride(), bt.data(), bt.stride(), c.data(), c.stride(), true, true);
+        CHECK(max_difference(c, Matrix<T>(n, m)) <= tolerance);
+      }
+    }
+  }
+}
+
+int main() {
+  // Целые результаты по модулю меньше 2^24 точны и во float
+  check_sizes<double>(0);
+  check_sizes<float>(0);
+  check_sizes<int>(0);
+  check_sizes<long long>(0);
+
+  // Блоки внутри больших матриц: шаги строк не равны ширине
+  Matrix<double> big = random_real_matrix<double>(40, 50, 7);
+  Matrix<double> c(50, 40);
+  gemm<double>(10, 12, 15, big.data() + 3, big.stride(), big.data() + 20 * 50 + 1, big.stride(),
+               c.data() + 5, c.stride());
+  Matrix<double> expected = naive_product(big.cutted(0, 3, 10, 18), big.cutted(20, 1, 35, 13));
+  CHECK(max_difference(c.cutted(0, 5, 10, 17), expected) < 1e-12);
+  CHECK(c[0][4] == 0 && c[0][17] == 0 && c[10][5] == 0);
+  return check_result();
+}
@@ -0,0 +1,47 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../Rational.h"
+
+int main() {
+  // Размеры по обе стороны от LU_BLOCK_SIZE, в том числе с неровным делением пополам
+  for (size_t n : {1, 2, 31, 32, 33, 100, 257}) {
+    Matrix<double> a = random_real_matrix<double>(n, n, n);
+    for (size_t i = 0; i < n; i++) {
+      a[i][i] += 2;
+    }
+    Matrix<double> inverse = a.inversed();
+    CHECK(inverse.size() == a.size());
+    CHECK(max_difference(naive_product(a, inverse), Identity<double>(n)) < 1e-12 * n);
+    CHECK(max_difference(naive_product(inverse, a), Identity<double>(n)) < 1e-12 * n);
+    CHECK(max_difference(inverse.inversed(), a) < 1e-11 * n);
+
+    Matrix<double> in_place = a;
+    in_place.inverse();
+    CHECK(equal(in_place, inverse));
+  }
+
+  // Точный случай: перестановки строк и дроби
+  Matrix<Rational> exact = random_matrix<Rational>(8, 8, -5, 5, 1);
+  exact[0][0] = 0;
+  exact[3][5] = Rational(1, 3);
+  Matrix<Rational> inverse = exact.inversed();
+  CHECK(equal(inverse * exact, Identity<Rational>(8)));
+  CHECK(equal(exact * inverse, Identity<Rational>(8)));
+
+  // Гаусс-Жордан над [A | E] даёт [E | A^-1]
+  Matrix<Rational> augmented(16, 8);
+  augmented.view(0, 0, 8, 8) = exact;
+  augmented.view(0, 8, 8, 16) = Identity<Rational>(8);
+  augmented.make_gauss();
+  CHECK(equal(Matrix<Rational>(augmented.view(0, 0, 8, 8)), Identity<Rational>(8)));
+  CHECK(equal(Matrix<Rational>(augmented.view(0, 8, 8, 16)), inverse));
+
+  Matrix<double> singular{{1, 2, 3}, {7, 8, 9}, {1, 2, 3}};
+  CHECK(singular.inversed().empty());
+  Matrix<Rational> exact_singular{{1, 2}, {2, 4}};
+  CHECK(exact_singular.inversed().empty());
+  return check_result();
+}
@@ -0,0 +1,109 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <complex>
+#include "Check.h"
+#include "../IterativeSolvers.h"
+
+// Пятиточечный лапласиан на сетке side x side, симметричный и положительно определённый
+SparseMatrix<double> laplacian(size_t side) {
+  std::vector<SparseEntry<double>> entries;
+  for (size_t i = 0; i < side; i++) {
+    for (size_t j = 0; j < side; j++) {
+      size_t index = i * side + j;
+      entries.push_back({index, index, 4});
+      if (i > 0) {
+        entries.push_back({index, index - side, -1});
+      }
+      if (i + 1 < side) {
+        entries.push_back({index, index + side, -1});
+      }
+      if (j > 0) {
+        entries.push_back({index, index - 1, -1});
+      }
+      if (j + 1 < side) {
+        entries.push_back({index, index + 1, -1});
+      }
+    }
+  }
+  return SparseMatrix<double>(side * side, side * side, entries);
+}
+
+double relative_residual(const Matrix<double> &a, const std::vector<double> &x, const std::vector<double> &b) {
+  return residual(a, x, b) / vector_norm(b);
+}
+
+int main() {
+  IterativeOptions options;
+  options.tolerance = 1e-10;
+
+  // Плотная симметричная положительно определённая A = B^T B + n E
+  size_t n = 60;
+  Matrix<double> b_matrix = random_real_matrix<double>(n, n, 1);
+  Matrix<double> spd = b_matrix.transposed() * b_matrix;
+  for (size_t i = 0; i < n; i++) {
+    spd[i][i] += double(n);
+  }
+  std::vector<double> rhs = random_vector(n, 2);
+  IterativeSolution<double> cg = conjugate_gradient(spd, rhs, options);
+  CHECK(cg.converged && relative_residual(spd, cg.x, rhs) < 1e-9);
+  CHECK(cg.residual_history.size() == cg.iterations + 1 && cg.residual_history.front() == 1);
+  IterativeSolution<double> jacobi_cg = conjugate_gradient(spd, rhs, options, JacobiPreconditioner<double>(spd));
+  CHECK(jacobi_cg.converged && relative_residual(spd, jacobi_cg.x, rhs) < 1e-9);
+
+  // Несимметричная матрица с преобладающей диагональю
+  Matrix<double> general = random_real_matrix<double>(n, n, 3);
+  for (size_t i = 0; i < n; i++) {
+    general[i][i] += 10;
+  }
+  IterativeSolution<double> bicg = bicgstab(general, rhs, options);
+  CHECK(bicg.converged && relative_residual(general, bicg.x, rhs) < 1e-9);
+  IterativeSolution<double> ilu_bicg = bicgstab(general, rhs, options, ILU0Preconditioner<double>(general));
+  CHECK(ilu_bicg.converged && relative_residual(general, ilu_bicg.x, rhs) < 1e-9);
+  IterativeSolution<double> gm = gmres(general, rhs, options);
+  CHECK(gm.converged && relative_residual(general, gm.x, rhs) < 1e-9);
+  // Плотная ILU(0) - полное LU, так что GMRES сходится почти сразу
+  IterativeSolution<double> ilu_gm = gmres(general, rhs, options, ILU0Preconditioner<double>(general));
+  CHECK(ilu_gm.converged && ilu_gm.iterations <= 3 && relative_residual(general, ilu_gm.x, rhs) < 1e-9);
+  IterativeOptions short_restart = options;
+  short_restart.restart = 5;
+  short_restart.max_iterations = 5000;
+  IterativeSolution<double> restarted = gmres(general, rhs, short_restart);
+  CHECK(restarted.converged && relative_residual(general, restarted.x, rhs) < 1e-9);
+
+  // Разреженный лапласиан: предобусловливание уменьшает число итераций
+  size_t side = 30;
+  SparseMatrix<double> grid = laplacian(side);
+  Matrix<double> dense_grid = grid.dense();
+  std::vector<double> grid_rhs = random_vector(side * side, 4);
+  IterativeSolution<double> plain = conjugate_gradient(grid, grid_rhs, options);
+  IterativeSolution<double> preconditioned = conjugate_gradient(grid, grid_rhs, options,
+                                                                ILU0Preconditioner<double>(grid));
+  CHECK(plain.converged && relative_residual(dense_grid, plain.x, grid_rhs) < 1e-9);
+  CHECK(preconditioned.converged && relative_residual(dense_grid, preconditioned.x, grid_rhs) < 1e-9);
+  CHECK(preconditioned.iterations < plain.iterations);
+  IterativeSolution<double> sparse_gm = gmres(grid, grid_rhs, options, JacobiPreconditioner<double>(grid));
+  CHECK(sparse_gm.converged && relative_residual(dense_grid, sparse_gm.x, grid_rhs) < 1e-9);
+
+  // Оператор, заданный функцией: A = diag(1, 2, ..., n)
+  auto diagonal = [](const std::vector<double> &x, std::vector<double> &y) {
+    for (size_t i = 0; i < x.size(); i++) {
+      y[i] = double(i + 1) * x[i];
+    }
+  };
+  IterativeSolution<double> functional = conjugate_gradient(diagonal, rhs, options);
+  CHECK(functional.converged);
+  for (size_t i = 0; i < n; i++) {
+    CHECK(std::abs(functional.x[i] * double(i + 1) - rhs[i]) < 1e-9);
+  }
+
+  // Нулевая правая часть сразу даёт нулевое решение
+  IterativeSolution<double> zero = bicgstab(general, std::vector<double>(n, 0), options);
+  CHECK(zero.converged && zero.iterations == 0 && vector_norm(zero.x) == 0);
+
+  // Рядом с <complex> имена вспомогательных функций не сталкиваются с std::norm
+  std::vector<double> v = {3, 4};
+  CHECK(vector_norm(v) == 5 && vector_dot(v, v) == 25 && std::norm(std::complex<double>(3, 4)) == 25);
+  return check_result();
+}
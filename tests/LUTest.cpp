@@ -0,0 +1,45 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+int main() {
+  for (size_t n : {1, 7, 33, 100}) {
+    Matrix<double> a = random_real_matrix<double>(n, n, n);
+    LU<double> lu = a.lu();
+    CHECK(!lu.singular() && lu.size() == n);
+
+    // P A = L U
+    Matrix<double> lower(n, n), upper(n, n), permuted(n, n);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        (j < i ? lower[i][j] : upper[i][j]) = lu.factors()[i][j];
+        permuted[i][j] = a[lu.permutation()[i]][j];
+      }
+      lower[i][i] = 1;
+    }
+    CHECK(max_difference(naive_product(lower, upper), permuted) < 1e-12 * n);
+
+    std::vector<double> b(n);
+    for (size_t i = 0; i < n; i++) {
+      b[i] = double(i) - 3;
+    }
+    CHECK(residual(a, lu.solve(b), b) < 1e-11 * n);
+
+    // Несколько правых частей сразу
+    Matrix<double> rhs = random_real_matrix<double>(n, 5, 1);
+    CHECK(max_difference(naive_product(a, lu.solve(rhs)), rhs) < 1e-11 * n);
+  }
+
+  Matrix<double> a{{2, 1}, {4, 5}};
+  CHECK(std::abs(a.lu().determinant() - 6) < 1e-14);
+  CHECK(max_difference(a.lu().solve(std::vector<double>{3, 9}), std::vector<double>{1, 1}) < 1e-14);
+
+  Matrix<double> singular{{1, 2}, {2, 4}};
+  CHECK(singular.lu().singular());
+  CHECK(singular.lu().determinant() == 0);
+  CHECK(singular.lu().solve(std::vector<double>{1, 1}).empty());
+  CHECK(singular.lu().solve(Identity<double>(2)).empty());
+  return check_result();
+}
@@ -0,0 +1,78 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <cstddef>
+#include <fstream>
+#include <unistd.h>
+#include "Check.h"
+#include "../LU.h"
+#include "../MatrixFile.h"
+
+std::string temporary_path(const std::string &name) {
+  return "/tmp/linalg_" + std::to_string(getpid()) + "_" + name;
+}
+
+// Перезаписывает поле заголовка по смещению offset
+void patch(const std::string &path, size_t offset, uint64_t value) {
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(offset);
+  file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+int main() {
+  std::string a_path = temporary_path("a.bin"), b_path = temporary_path("b.bin"), c_path = temporary_path("c.bin");
+
+  Matrix<double> a = random_real_matrix<double>(70, 50, 1);
+  CHECK(write_matrix_file(a_path, a));
+  CHECK(equal(read_matrix_file<double>(a_path), a));
+  // Файл другого типа не открывается
+  CHECK(read_matrix_file<float>(a_path).empty());
+  CHECK(MappedMatrix<long long>::open(a_path).empty());
+
+  // Блок с шагом больше ширины записывается плотно
+  const Matrix<int> big = random_matrix<int>(20, 30, -100, 100, 2);
+  CHECK(write_matrix_file<int>(b_path, big.view(3, 4, 13, 24)));
+  CHECK(equal(read_matrix_file<int>(b_path), Matrix<int>(big.view(3, 4, 13, 24))));
+
+  // Умножение вне памяти с плиткой, не делящей размеры
+  Matrix<double> b = random_real_matrix<double>(50, 45, 3);
+  CHECK(write_matrix_file(b_path, b));
+  CHECK(multiply_matrix_files<double>(c_path, a_path, b_path, 16));
+  CHECK(max_difference(read_matrix_file<double>(c_path), naive_product(a, b)) < 1e-12);
+  CHECK(!multiply_matrix_files<double>(c_path, b_path, b_path, 16));
+
+  // LU вне памяти с полосами, не делящими размер
+  Matrix<double> square = random_real_matrix<double>(100, 100, 4);
+  CHECK(write_matrix_file(a_path, square));
+  MappedLU<double> mapped(a_path, 24);
+  CHECK(!mapped.singular());
+  std::vector<double> rhs(100, 1);
+  CHECK(residual(square, mapped.solve(rhs), rhs) < 1e-11);
+  CHECK(std::abs(mapped.determinant() - square.lu().determinant()) < 1e-9 * std::abs(square.lu().determinant()));
+  CHECK(max_difference(read_matrix_file<double>(a_path), square.lu().factors()) < 1e-10);
+
+  // Испорченные заголовки, в том числе с размерами, чьё произведение переполняет 64 бита
+  Matrix<double> small = random_real_matrix<double>(4, 4, 5);
+  auto corrupted = [&](size_t offset, uint64_t value) {
+    write_matrix_file(b_path, small);
+    patch(b_path, offset, value);
+    return MappedMatrix<double>::open(b_path).empty();
+  };
+  CHECK(!corrupted(offsetof(MatrixFileHeader, reserved), 0));
+  CHECK(corrupted(offsetof(MatrixFileHeader, magic), 0));
+  CHECK(corrupted(offsetof(MatrixFileHeader, vertical_size), 5));
+  CHECK(corrupted(offsetof(MatrixFileHeader, vertical_size), uint64_t(1) << 61));
+  CHECK(corrupted(offsetof(MatrixFileHeader, stride), uint64_t(1) << 61));
+  CHECK(corrupted(offsetof(MatrixFileHeader, stride), 0));
+  CHECK(corrupted(offsetof(MatrixFileHeader, data_offset), uint64_t(-4096)));
+  CHECK(corrupted(offsetof(MatrixFileHeader, data_offset), 1 << 20));
+  CHECK(corrupted(offsetof(MatrixFileHeader, data_offset), 0));
+  CHECK(corrupted(offsetof(MatrixFileHeader, horizontal_size), 5));
+  CHECK(MappedMatrix<double>::open(temporary_path("missing.bin")).empty());
+
+  std::remove(a_path.c_str());
+  std::remove(b_path.c_str());
+  std::remove(c_path.c_str());
+  return check_result();
+}
@@ -0,0 +1,48 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+int main() {
+  Matrix<int> a{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+  MatrixView<int> block = a.view(1, 1, 3, 3);
+  CHECK(block.vertical_size() == 2 && block.horizontal_size() == 2 && block.stride() == 4);
+  CHECK(block(0, 0) == 6 && block(1, 1) == 11);
+
+  // Запись через взгляд меняет исходную матрицу
+  block(0, 1) = 70;
+  CHECK(a[1][2] == 70);
+  block.view(1, 0, 2, 2).fill(0);
+  CHECK(a[2][1] == 0 && a[2][2] == 0 && a[2][0] == 9 && a[2][3] == 12);
+
+  // Присваивание в взгляд копирует элементы, копия взгляда - нет
+  Matrix<int> b{{-1, -2}, {-3, -4}};
+  a.view(0, 2, 2, 4) = b.view();
+  CHECK(equal(a, Matrix<int>{{1, 2, -1, -2}, {5, 6, -3, -4}, {9, 0, 0, 12}}));
+  MatrixView<int> copy = block;
+  CHECK(copy.data() == block.data());
+
+  a.view(0, 0, 2, 2) += b.view();
+  CHECK(a[0][0] == 0 && a[1][1] == 2);
+  a.view(0, 0, 2, 2) -= b.view() * 2;
+  CHECK(a[0][0] == 2 && a[1][1] == 10);
+  a.view(2, 0, 3, 4) *= 3;
+  CHECK(a[2][0] == 27 && a[2][3] == 36);
+  a.view().swap_lines(0, 2);
+  CHECK(a[0][0] == 27 && a[2][0] == 2);
+
+  // Умножение блоков внутри больших матриц
+  Matrix<double> big = random_matrix<double>(30, 30, -5, 5, 1);
+  Matrix<double> result(30, 30);
+  multiply_add<double>(result.view(5, 5, 15, 25), big.view(0, 0, 10, 7), big.view(20, 10, 27, 30));
+  CHECK(equal(result.cutted(5, 5, 15, 25), naive_product(big.cutted(0, 0, 10, 7), big.cutted(20, 10, 27, 30))));
+  multiply_subtract<double>(result.view(5, 5, 15, 25), big.view(0, 0, 10, 7), big.view(20, 10, 27, 30));
+  CHECK(equal(result, Matrix<double>(30, 30)));
+
+  // Гаусс внутри блока не трогает остальное
+  Matrix<double> system{{0, 0, 0, 0}, {0, 2, 4, 0}, {0, 1, 3, 0}};
+  system.view(1, 1, 3, 3).make_gauss();
+  CHECK(equal(system, Matrix<double>{{0, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}}));
+  return check_result();
+}
@@ -0,0 +1,107 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <limits>
+#include <thread>
+#include "Check.h"
+
+// Обратная ошибка max |A x - b| / (|A| |x|) в норме максимума
+double backward_error(const Matrix<double> &a, const std::vector<double> &x, const std::vector<double> &b) {
+  double a_norm = 0;
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    double sum = 0;
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      sum += std::abs(a[i][j]);
+    }
+    a_norm = std::max(a_norm, sum);
+  }
+  double x_norm = 0;
+  for (double value : x) {
+    x_norm = std::max(x_norm, std::abs(value));
+  }
+  return residual(a, x, b) / (a_norm * x_norm);
+}
+
+int main() {
+  double eps = std::numeric_limits<double>::epsilon();
+
+  // Хорошо обусловленная система: уточнение доводит ошибку до уровня double за несколько шагов
+  for (size_t n : {1, 10, 150}) {
+    Matrix<double> a = random_real_matrix<double>(n, n, n);
+    for (size_t i = 0; i < n; i++) {
+      a[i][i] += 4;
+    }
+    std::vector<double> b = random_vector(n, n + 1);
+    MixedPrecisionSolution<double> solution = MixedPrecisionLU<double>(a).solve(b);
+    const std::vector<double> &x = solution.x;
+    CHECK(x.size() == n);
+    CHECK(solution.refined && solution.iterations >= 1 && solution.iterations <= 5);
+    CHECK(backward_error(a, x, b) <= std::sqrt(double(n)) * eps);
+    CHECK(max_difference(x, a.solve(b)) < 1e-12);
+    CHECK(max_difference(a.mixed_precision_solve(b), x) == 0);
+  }
+
+  // Матрица Гильберта плохо обусловлена для float: невязка перестаёт уменьшаться, уточнение останавливается
+  // задолго до max_iterations, и решение берётся в double
+  size_t hilbert_size = 10;
+  Matrix<double> hilbert(hilbert_size, hilbert_size);
+  for (size_t i = 0; i < hilbert_size; i++) {
+    for (size_t j = 0; j < hilbert_size; j++) {
+      hilbert[i][j] = 1.0 / double(i + j + 1);
+    }
+  }
+  std::vector<double> hilbert_b(hilbert_size, 1);
+  MixedPrecisionLU<double> hilbert_lu(hilbert);
+  MixedPrecisionSolution<double> hilbert_solution = hilbert_lu.solve(hilbert_b);
+  CHECK(!hilbert_solution.refined && hilbert_solution.iterations <= 3);
+  CHECK(max_difference(hilbert_solution.x, hilbert.solve(hilbert_b)) == 0);
+  // Разложение в double строится один раз, в том числе когда первые вызовы идут из разных потоков
+  MixedPrecisionLU<double> shared_lu(hilbert);
+  std::vector<MixedPrecisionSolution<double>> parallel_solutions(4);
+  std::vector<std::thread> threads;
+  for (size_t index = 0; index < parallel_solutions.size(); index++) {
+    threads.emplace_back([&, index] {
+      parallel_solutions[index] = shared_lu.solve(hilbert_b);
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (const MixedPrecisionSolution<double> &solution : parallel_solutions) {
+    CHECK(!solution.refined && max_difference(solution.x, hilbert_solution.x) == 0);
+  }
+
+  // Число обусловленности 10^6: шаг уменьшает невязку лишь примерно в 10 раз, но уточнение не бросается
+  Matrix<double> left = QR<double>(random_real_matrix<double>(30, 30, 9)).q();
+  Matrix<double> right = QR<double>(random_real_matrix<double>(30, 30, 10)).q();
+  for (size_t j = 0; j < 30; j++) {
+    for (size_t i = 0; i < 30; i++) {
+      left[i][j] *= std::pow(1e6, -double(j) / 29);
+    }
+  }
+  Matrix<double> graded = (left * right).eval();
+  std::vector<double> graded_b = random_vector(30, 10);
+  MixedPrecisionSolution<double> graded_solution = MixedPrecisionLU<double>(graded).solve(graded_b);
+  CHECK(graded_solution.refined && graded_solution.iterations >= 3);
+  CHECK(backward_error(graded, graded_solution.x, graded_b) <= std::sqrt(30.0) * eps);
+
+  // Элементы не помещаются во float
+  Matrix<double> huge = random_real_matrix<double>(20, 20, 5);
+  for (size_t i = 0; i < 20; i++) {
+    huge[i][i] += 4;
+  }
+  huge *= 1e300;
+  std::vector<double> huge_b = random_vector(20, 6);
+  MixedPrecisionSolution<double> huge_solution = MixedPrecisionLU<double>(huge).solve(huge_b);
+  CHECK(!huge_solution.refined && huge_solution.iterations == 0);
+  CHECK(backward_error(huge, huge_solution.x, huge_b) <= 20 * eps);
+
+  // Вырожденная матрица
+  Matrix<double> singular = random_real_matrix<double>(8, 8, 7);
+  for (size_t j = 0; j < 8; j++) {
+    singular[7][j] = singular[0][j];
+  }
+  CHECK(MixedPrecisionLU<double>(singular).solve(random_vector(8, 8)).x.empty());
+  return check_result();
+}
@@ -0,0 +1,66 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../Rational.h"
+
+int main() {
+  Matrix<int> a = random_matrix<int>(20, 30, -100, 100, 1);
+  Matrix<int> b = random_matrix<int>(20, 30, -100, 100, 2);
+  Matrix<int> sum = (a + b).eval(), difference = (a - b).eval(), negated = (-a).eval(), scaled = (a * 3).eval();
+
+  // Временный операнд отдаёт свой буфер результату
+  Matrix<int> temporary = a;
+  const int *buffer = temporary.data();
+  Matrix<int> result = std::move(temporary) + b;
+  CHECK(result.data() == buffer && equal(result, sum));
+  temporary = b;
+  buffer = temporary.data();
+  result = a - std::move(temporary);
+  CHECK(result.data() == buffer && equal(result, difference));
+  temporary = a;
+  buffer = temporary.data();
+  result = -std::move(temporary);
+  CHECK(result.data() == buffer && equal(result, negated));
+  temporary = a;
+  buffer = temporary.data();
+  result = std::move(temporary) * 3;
+  CHECK(result.data() == buffer && equal(result, scaled));
+  CHECK(equal(Matrix<int>(a) + Matrix<int>(b), sum));
+  CHECK(equal(Matrix<int>(a) - Matrix<int>(b), difference));
+
+  // Перегрузки для временных дают то же, что и для lvalue
+  Matrix<double> square = random_real_matrix<double>(12, 12, 3);
+  CHECK(equal(Matrix<double>(square).transposed(), square.transposed()));
+  CHECK(equal(Matrix<double>(square).inversed(), square.inversed()));
+  CHECK(equal(Matrix<double>(square).gauss(), square.gauss()));
+  CHECK(equal(Matrix<double>(square).cutted(2, 3, 7, 11), square.cutted(2, 3, 7, 11)));
+  CHECK(equal(Matrix<double>(square) | square, square | square));
+  Matrix<double> scaled_in_place = square;
+  (scaled_in_place *= 2) *= 0.5;
+  CHECK(equal(scaled_in_place, square));
+
+  // Многочлены: деление с остатком прямо в коэффициентах
+  Polynomial<Rational> p({Rational(-18), Rational(1, 2), Rational(-9), Rational(1), Rational(3)});
+  Polynomial<Rational> q({Rational(2), Rational(0), Rational(1, 3)});
+  Polynomial<Rational> quotient = p / q, remainder = p % q;
+  CHECK(remainder.Degree() < q.Degree());
+  CHECK(quotient * q + remainder == p);
+  CHECK(Polynomial<Rational>(p) / q == quotient && Polynomial<Rational>(p) % q == remainder);
+  CHECK(-Polynomial<Rational>(p) == -p && -p + p == Polynomial<Rational>());
+  CHECK(Polynomial<int>({1, 1}) * Polynomial<int>({-1, 1}) == Polynomial<int>({-1, 0, 1}));
+
+  // Короткая перестановка продолжается тождественно
+  Permutation cycle({1, 2, 0});
+  Permutation swap({0, 1, 2, 4, 3});
+  Permutation product = cycle * swap;
+  CHECK(product == Permutation({1, 2, 0, 4, 3}));
+  CHECK(swap * cycle == Permutation({1, 2, 0, 4, 3}));
+  Permutation power = cycle;
+  power *= cycle;
+  power *= cycle;
+  CHECK(power == Permutation({0, 1, 2}));
+  CHECK(cycle * Permutation(cycle).inverse() == Permutation({0, 1, 2}));
+  return check_result();
+}
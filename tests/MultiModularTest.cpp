@@ -0,0 +1,111 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <sstream>
+#include "Check.h"
+#include "../BigInteger.h"
+#include "../MultiModular.h"
+
+template<typename T>
+Matrix<BigInteger> big_matrix(const Matrix<T> &matrix) {
+  Matrix<BigInteger> result(matrix.horizontal_size(), matrix.vertical_size());
+  for (size_t i = 0; i < matrix.vertical_size(); i++) {
+    for (size_t j = 0; j < matrix.horizontal_size(); j++) {
+      result[i][j] = BigInteger(matrix[i][j]);
+    }
+  }
+  return result;
+}
+
+// A x = b для x = numerators / denominator, в целых числах
+template<typename T>
+bool solves(const Matrix<T> &a, const MultimodularSolution &solution, const std::vector<T> &b) {
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    BigInteger sum = -BigInteger(b[i]) * solution.denominator;
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      sum += BigInteger(a[i][j]) * solution.numerators[j];
+    }
+    if (!sum.is_zero()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  std::ostringstream out;
+  out << BigInteger(-123456789012345678LL) * BigInteger(1000000000000LL);
+  CHECK(out.str() == "-123456789012345678000000000000");
+
+  Matrix<long long> small{{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+  CHECK(multimodular_determinant(small) == 6);
+  CHECK(multimodular_determinant(Matrix<long long>(3, 3)) == 0);
+  CHECK(!multimodular_determinant(Matrix<long long>(2, 3)));
+
+  // Определитель, который не помещается в long long, против метода Барейса в длинной арифметике
+  Matrix<long long> a = random_matrix<long long>(40, 40, -1000, 1000, 1);
+  std::optional<BigInteger> determinant = multimodular_determinant(a);
+  CHECK(determinant && determinant->bit_length() > 300);
+  CHECK(determinant == big_matrix(a).determinant());
+
+  // Ответ по модулю постороннего простого для большой матрицы
+  using Field = ModInt<998244353>;
+  Matrix<long long> large = random_matrix<long long>(150, 150, -1000, 1000, 2);
+  Matrix<Field> reduced(150, 150);
+  for (size_t i = 0; i < 150; i++) {
+    for (size_t j = 0; j < 150; j++) {
+      reduced[i][j] = Field(static_cast<int>((large[i][j] % 998244353 + 998244353) % 998244353));
+    }
+  }
+  CHECK(multimodular_determinant(large)->residue(998244353) == reduced.determinant().value());
+
+  std::vector<long long> b(40);
+  for (size_t i = 0; i < 40; i++) {
+    b[i] = static_cast<long long>(i * i) - 500;
+  }
+  MultimodularSolution solution = multimodular_solve(a, b);
+  CHECK(solution.numerators.size() == 40);
+  CHECK(solution.denominator == abs(*determinant));
+  CHECK(solves(a, solution, b));
+
+  std::vector<long long> large_b(150, 7);
+  MultimodularSolution large_solution = multimodular_solve(large, large_b);
+  CHECK(large_solution.numerators.size() == 150 && solves(large, large_solution, large_b));
+
+  Matrix<long long> diagonal{{2, 0}, {0, -4}};
+  MultimodularSolution fractions = multimodular_solve(diagonal, std::vector<long long>{1, 1});
+  CHECK(fractions.fraction(0) == std::make_pair(BigInteger(1), BigInteger(2)));
+  CHECK(fractions.fraction(1) == std::make_pair(BigInteger(-1), BigInteger(4)));
+
+  Matrix<long long> singular{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+  CHECK(multimodular_determinant(singular) == 0);
+  CHECK(multimodular_solve(singular, std::vector<long long>{1, 2, 3}).numerators.empty());
+
+  Matrix<long long> left = random_matrix<long long>(50, 10, -5, 5, 3);
+  Matrix<long long> right = random_matrix<long long>(10, 50, -5, 5, 4);
+  CHECK(multimodular_rank(naive_product(left, right)) == 10);
+  // Элемент делится на оба наибольших простых меньше 2^31, ранг по ним нулевой
+  long long two_primes = 2147483647ll * 2147483629ll;
+  CHECK(multimodular_rank(Matrix<long long>{{two_primes}}) == 1);
+  CHECK(multimodular_rank(Matrix<long long>{{two_primes, 0}, {0, two_primes}}) == 2);
+  CHECK(multimodular_rank(Matrix<long long>{{two_primes, 2 * two_primes}, {3, 6}}) == 1);
+  CHECK(multimodular_rank(Matrix<long long>(3, 4)) == 0);
+  CHECK(multimodular_rank(Matrix<long long>()) == 0);
+
+  // Ядро исключения по модулю против эталонного
+  uint32_t prime = 2147483629;
+  Montgomery field(prime);
+  std::vector<uint32_t> x(1000), y(1000);
+  for (size_t i = 0; i < 1000; i++) {
+    x[i] = static_cast<uint32_t>((i * 2654435761u) % prime);
+    y[i] = static_cast<uint32_t>((i * 40503u + 17) % prime);
+  }
+  for (size_t size : {0, 1, 7, 8, 9, 1000}) {
+    std::vector<uint32_t> expected = y, actual = y;
+    reference_modular_sub_scaled(size, 123456789u, x.data(), expected.data(), prime, field.negated_inverse());
+    modular_sub_scaled(size, 123456789u, x.data(), actual.data(), prime, field.negated_inverse());
+    CHECK(actual == expected);
+  }
+  return check_result();
+}
@@ -0,0 +1,86 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <cstdlib>
+#include <new>
+#include "Check.h"
+#include "../ModInt.h"
+#include "../Rational.h"
+
+// Счётчик обращений к куче, чтобы проверить, что шаги возведения в степень не выделяют память.
+// noinline у delete: иначе gcc видит пару new/free и ложно предупреждает о несоответствии
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+__attribute__((noinline)) void operator delete(void *pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+template<typename T>
+Matrix<T> identity(size_t n) {
+  Matrix<T> result(n, n);
+  for (size_t i = 0; i < n; i++) {
+    result[i][i] = T(1);
+  }
+  return result;
+}
+
+template<typename T>
+size_t allocations_of_pow(const Matrix<T> &a, long long power) {
+  Matrix<T> copy = a;
+  size_t before = allocations;
+  copy.pow(power);
+  return allocations - before;
+}
+
+int main() {
+  // Точные степени против повторного умножения
+  Matrix<long long> a = random_matrix<long long>(7, 7, -2, 2, 1);
+  Matrix<long long> expected = identity<long long>(7);
+  for (long long power = 0; power <= 12; power++) {
+    CHECK(equal(a.powered(power), expected));
+    expected = naive_product(expected, a);
+  }
+
+  // Отрицательная степень - степень обратной: A^-3 A^3 = E точно
+  Matrix<Rational> fraction = random_matrix<Rational>(5, 5, -4, 4, 2);
+  CHECK(equal(fraction.powered(-3) * fraction.powered(3), identity<Rational>(5)));
+  CHECK(equal(fraction.powered(-1), fraction.inversed()));
+  Matrix<Rational> singular = fraction;
+  for (size_t j = 0; j < 5; j++) {
+    singular[4][j] = singular[0][j] + singular[1][j];
+  }
+  CHECK(singular.powered(-2).empty());
+  CHECK(Matrix<long long>(3, 4).powered(2).empty());
+
+  // Число выделений памяти не зависит от показателя, если блоки пакуются в буферы потока
+  Matrix<double> small = random_real_matrix<double>(16, 16, 3);
+  small *= 0.1;
+  allocations_of_pow(small, 5);
+  size_t few_steps = allocations_of_pow(small, 2);
+  size_t many_steps = allocations_of_pow(small, (1ll << 40) + 12345);
+  CHECK(few_steps == many_steps);
+
+  // Через характеристический многочлен получается то же, что и бинарным возведением
+  using Field = ModInt<998244353>;
+  Matrix<Field> field = random_matrix<Field>(9, 9, -1000, 1000, 4);
+  unsigned long long huge = 1000000000000000007ull;
+  CHECK(equal(field.powered_by_characteristic_polynomial(huge), field.powered(huge)));
+  for (unsigned long long power = 0; power < 20; power++) {
+    CHECK(equal(field.powered_by_characteristic_polynomial(power), field.powered(power)));
+  }
+  CHECK(equal(a.powered_by_characteristic_polynomial(12), a.powered(12)));
+  return check_result();
+}
@@ -0,0 +1,112 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../QR.h"
+
+// A P: столбец j - это столбец permutation[j] матрицы A
+Matrix<double> permuted_columns(const Matrix<double> &a, const std::vector<size_t> &permutation) {
+  Matrix<double> result(a.horizontal_size(), a.vertical_size());
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      result[i][j] = a[i][permutation[j]];
+    }
+  }
+  return result;
+}
+
+Matrix<double> identity(size_t n) {
+  Matrix<double> result(n, n);
+  for (size_t i = 0; i < n; i++) {
+    result[i][i] = 1;
+  }
+  return result;
+}
+
+// max |(A^T (A x - b))_j| - для решения наименьших квадратов равно нулю
+double normal_residual(const Matrix<double> &a, const std::vector<double> &x, const std::vector<double> &b) {
+  std::vector<double> r(a.vertical_size());
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    r[i] = -b[i];
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      r[i] += a[i][j] * x[j];
+    }
+  }
+  double result = 0;
+  for (size_t j = 0; j < a.horizontal_size(); j++) {
+    double sum = 0;
+    for (size_t i = 0; i < a.vertical_size(); i++) {
+      sum += a[i][j] * r[i];
+    }
+    result = std::max(result, std::abs(sum));
+  }
+  return result;
+}
+
+void check_factorization(const Matrix<double> &a, bool pivoting) {
+  QR<double> qr(a, pivoting);
+  Matrix<double> q = qr.q();
+  Matrix<double> r = qr.r();
+  size_t k = std::min(a.vertical_size(), a.horizontal_size());
+  CHECK(q.vertical_size() == a.vertical_size() && q.horizontal_size() == k);
+  CHECK(max_difference((q.transposed() * q).eval(), identity(k)) < 1e-12);
+  CHECK(max_difference((q * r).eval(), permuted_columns(a, qr.column_permutation())) < 1e-12);
+  for (size_t i = 0; i < r.vertical_size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      CHECK(r[i][j] == 0);
+    }
+  }
+  if (pivoting) {
+    for (size_t i = 0; i + 1 < k; i++) {
+      CHECK(std::abs(r[i][i]) >= std::abs(r[i + 1][i + 1]));
+    }
+  }
+}
+
+int main() {
+  // Размеры больше QR_BLOCK_SIZE проверяют блочное обновление, в том числе неполный последний блок
+  for (bool pivoting : {false, true}) {
+    check_factorization(random_real_matrix<double>(100, 70, 1), pivoting);
+    check_factorization(random_real_matrix<double>(45, 80, 2), pivoting);
+    check_factorization(random_real_matrix<double>(33, 33, 3), pivoting);
+    check_factorization(random_real_matrix<double>(7, 1, 4), pivoting);
+  }
+
+  // Переопределённая система полного ранга: все три способа дают решение нормальных уравнений
+  Matrix<double> tall = random_real_matrix<double>(500, 12, 5);
+  std::vector<double> b = random_vector(500, 6);
+  std::vector<double> blocked = QR<double>(tall).least_squares(b);
+  std::vector<double> pivoted = QR<double>(tall, true).least_squares(b);
+  std::vector<double> tsqr = tsqr_least_squares(tall, b, 50);
+  CHECK(normal_residual(tall, blocked, b) < 1e-11);
+  CHECK(max_difference(blocked, pivoted) < 1e-12);
+  CHECK(max_difference(blocked, tsqr) < 1e-12);
+  CHECK(max_difference(blocked, tsqr_least_squares(tall, b)) < 1e-12);
+
+  // Совместная система решается точно до округления
+  Matrix<double> square = random_real_matrix<double>(40, 40, 7);
+  std::vector<double> exact = random_vector(40, 8);
+  CHECK(residual(square, QR<double>(square).least_squares(exact), exact) < 1e-12);
+
+  // Ранг 5: столбцы с 5 по 19 - комбинации первых пяти
+  Matrix<double> deficient = random_real_matrix<double>(60, 20, 9);
+  for (size_t j = 5; j < 20; j++) {
+    for (size_t i = 0; i < 60; i++) {
+      deficient[i][j] = deficient[i][j % 5] - 0.5 * deficient[i][(j + 1) % 5];
+    }
+  }
+  QR<double> rank_revealing(deficient, true);
+  CHECK(rank_revealing.rank() == 5);
+  std::vector<double> deficient_b = random_vector(60, 10);
+  std::vector<double> basic = rank_revealing.least_squares(deficient_b);
+  CHECK(normal_residual(deficient, basic, deficient_b) < 1e-11);
+  size_t nonzero = 0;
+  for (double value : basic) {
+    nonzero += value != 0;
+  }
+  CHECK(nonzero == 5);
+  CHECK(QR<double>(deficient).least_squares(deficient_b).empty());
+  CHECK(tsqr_least_squares(deficient, deficient_b, 25).empty());
+  return check_result();
+}
@@ -0,0 +1,103 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../MultiModular.h"
+#include "../Rational.h"
+
+// m x n матрица ранга rank как произведение случайных m x rank и rank x n
+template<typename T>
+Matrix<T> low_rank_matrix(size_t m, size_t n, size_t rank, unsigned seed) {
+  return (random_matrix<T>(m, rank, -3, 3, seed) * random_matrix<T>(rank, n, -3, 3, seed + 1)).eval();
+}
+
+template<typename T>
+bool is_row_echelon(const Matrix<T> &echelon, const std::vector<size_t> &pivots) {
+  for (size_t i = 0; i < echelon.vertical_size(); i++) {
+    // Левее ведущего элемента строки i и во всех строках ниже последнего ведущего - нули
+    size_t first_nonzero = i < pivots.size() ? pivots[i] : echelon.horizontal_size();
+    for (size_t j = 0; j < first_nonzero; j++) {
+      if (!(echelon[i][j] == T(0))) {
+        return false;
+      }
+    }
+    if (i < pivots.size() && (echelon[i][pivots[i]] == T(0) || (i > 0 && pivots[i] <= pivots[i - 1]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Ранг, ступенчатый вид, ядро и образ точного типа: для встроенных целых исключение идёт без дробей
+template<typename T>
+void check_exact(const Matrix<T> &a, size_t rank) {
+  size_t m = a.vertical_size();
+  size_t n = a.horizontal_size();
+  CHECK(a.rank() == rank);
+  CHECK(a.transposed().eval().rank() == rank);
+  std::vector<size_t> pivots = a.pivot_columns();
+  CHECK(pivots.size() == rank);
+  Matrix<T> echelon = a;
+  CHECK(echelon.make_row_echelon() == pivots);
+  CHECK(is_row_echelon(echelon, pivots));
+  CHECK(equal(a.row_echelon(), echelon));
+  Matrix<T> kernel = a.null_space();
+  CHECK(kernel.vertical_size() == n && kernel.horizontal_size() == n - rank);
+  CHECK(equal((a * kernel).eval(), Matrix<T>(n - rank, m)));
+  CHECK(kernel.rank() == n - rank);
+  Matrix<T> image = a.column_space();
+  CHECK(image.vertical_size() == m && image.horizontal_size() == rank && image.rank() == rank);
+}
+
+int main() {
+  // Точный ранг над Q и над целыми, базисы ядра и образа
+  for (size_t rank : {0, 1, 3, 6}) {
+    unsigned seed = unsigned(rank + 1);
+    check_exact(low_rank_matrix<Rational>(6, 9, rank, seed), rank);
+    check_exact(low_rank_matrix<int>(6, 9, rank, seed), rank);
+    check_exact(low_rank_matrix<long long>(6, 9, rank, seed), rank);
+    CHECK(multimodular_rank(low_rank_matrix<long long>(6, 9, rank, seed)) == rank);
+  }
+  // Деление с отбрасыванием остатка приняло бы пропорциональные строки за независимые
+  CHECK(Matrix<int>({{2, 4}, {3, 6}}).rank() == 1);
+  Matrix<int> proportional({{2, 4, 1}, {3, 6, 1}, {5, 10, 2}});
+  Matrix<int> proportional_kernel = proportional.null_space();
+  CHECK(proportional.rank() == 2 && proportional_kernel.horizontal_size() == 1);
+  CHECK(equal((proportional * proportional_kernel).eval(), Matrix<int>(1, 3)));
+  CHECK(proportional.column_space().rank() == 2);
+  // Произведения p a_ij выходят за long long и считаются в __int128, а сами миноры в него помещаются
+  Matrix<long long> large = low_rank_matrix<long long>(3, 5, 2, 20);
+  large *= 100000;
+  check_exact(large, 2);
+
+  // Высокая матрица полного ранга и вырожденные размеры
+  CHECK(random_matrix<Rational>(200, 5, -9, 9, 10).rank() == 5);
+  CHECK(Matrix<Rational>(0, 0).rank() == 0);
+  CHECK(Matrix<Rational>(4, 3).rank() == 0);
+  CHECK(Matrix<Rational>(4, 3).null_space().horizontal_size() == 4);
+
+  // Гаусс пропускает нулевые столбцы и останавливается, когда ненулевых не осталось
+  Matrix<Rational> skipped({{0, 1, 2}, {0, 2, 5}, {0, 0, 0}});
+  CHECK(equal(skipped.gauss(), Matrix<Rational>({{0, 1, 0}, {0, 0, 1}, {0, 0, 0}})));
+  CHECK(equal(Matrix<Rational>(3, 2).gauss(), Matrix<Rational>(3, 2)));
+
+  // Числа с плавающей точкой: ранг с допуском и ядро с малой невязкой
+  Matrix<double> real = (random_real_matrix<double>(40, 7, 11) * random_real_matrix<double>(7, 30, 12)).eval();
+  CHECK(real.rank() == 7);
+  Matrix<double> real_kernel = real.null_space();
+  CHECK(real_kernel.horizontal_size() == 23);
+  CHECK(max_difference((real * real_kernel).eval(), Matrix<double>(23, 40)) < 1e-10);
+  for (unsigned seed = 0; seed < 20; seed++) {
+    size_t m = 20 + seed * 7 % 60, n = 15 + seed * 11 % 50, rank = 1 + seed * 13 % std::min(m, n);
+    Matrix<double> product = (random_real_matrix<double>(m, rank, seed) *
+                              random_real_matrix<double>(rank, n, seed + 100)).eval();
+    CHECK(product.rank() == rank && product.null_space().horizontal_size() == n - rank);
+  }
+
+  // Большие целые: ранг по модулю простых
+  Matrix<long long> big = low_rank_matrix<long long>(30, 30, 17, 13);
+  big *= 1000000007ll;
+  CHECK(multimodular_rank(big) == 17);
+  return check_result();
+}
@@ -0,0 +1,73 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+// Векторные ядра сравниваются с переносимыми на всех длинах хвостов; целые значения дают точное совпадение
+template<typename T, typename Add, typename Scale, typename SubScaled, typename Kernel>
+void check_kernels(Add add, Scale scale, SubScaled sub_scaled, Kernel kernel) {
+  constexpr size_t MR = GemmBlocking<T>::MR;
+  constexpr size_t NR = GemmBlocking<T>::NR;
+  for (size_t size = 0; size < 40; size++) {
+    std::vector<T> x(size), y(size);
+    for (size_t i = 0; i < size; i++) {
+      x[i] = T(int(i % 7) - 3);
+      y[i] = T(int(i % 5));
+    }
+    std::vector<T> expected = y, actual = y;
+    reference_vector_add(size, x.data(), expected.data());
+    add(size, x.data(), actual.data());
+    CHECK(expected == actual);
+    reference_vector_scale(size, T(3), expected.data());
+    scale(size, T(3), actual.data());
+    CHECK(expected == actual);
+    reference_vector_sub_scaled(size, T(-2), x.data(), expected.data());
+    sub_scaled(size, T(-2), x.data(), actual.data());
+    CHECK(expected == actual);
+  }
+
+  size_t depth = 37;
+  std::vector<T> a(depth * MR), b(depth * NR);
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = T(int(i % 9) - 4);
+  }
+  for (size_t i = 0; i < b.size(); i++) {
+    b[i] = T(int(i % 11) - 5);
+  }
+  size_t ldc = NR + 3;
+  std::vector<T> expected(MR * ldc, T(1)), actual = expected;
+  reference_gemm_kernel<T, MR, NR>(depth, a.data(), b.data(), expected.data(), ldc);
+  kernel(depth, a.data(), b.data(), actual.data(), ldc);
+  CHECK(expected == actual);
+}
+
+int main() {
+  // Диспетчер выбирает ядра для этого процессора
+  check_kernels<double>(
+          [](size_t n, const double *x, double *y) { vector_add(n, x, y); },
+          [](size_t n, const double &s, double *x) { vector_scale(n, s, x); },
+          [](size_t n, const double &s, const double *x, double *y) { vector_sub_scaled(n, s, x, y); },
+          [](size_t d, const double *a, const double *b, double *c, size_t ldc) { gemm_kernel(d, a, b, c, ldc); });
+  check_kernels<float>(
+          [](size_t n, const float *x, float *y) { vector_add(n, x, y); },
+          [](size_t n, const float &s, float *x) { vector_scale(n, s, x); },
+          [](size_t n, const float &s, const float *x, float *y) { vector_sub_scaled(n, s, x, y); },
+          [](size_t d, const float *a, const float *b, float *c, size_t ldc) { gemm_kernel(d, a, b, c, ldc); });
+#ifdef LINEARALG_SIMD_X86
+  // Ядра AVX2 проверяются и там, где диспетчер выбрал бы AVX-512
+  if (simd_level() != SimdLevel::Scalar) {
+    check_kernels<double>(
+            [](size_t n, const double *x, double *y) { avx2_vector_add(n, x, y); },
+            [](size_t n, const double &s, double *x) { avx2_vector_scale(n, s, x); },
+            [](size_t n, const double &s, const double *x, double *y) { avx2_vector_sub_scaled(n, s, x, y); },
+            [](size_t d, const double *a, const double *b, double *c, size_t ldc) { avx2_gemm_kernel(d, a, b, c, ldc); });
+    check_kernels<float>(
+            [](size_t n, const float *x, float *y) { avx2_vector_add(n, x, y); },
+            [](size_t n, const float &s, float *x) { avx2_vector_scale(n, s, x); },
+            [](size_t n, const float &s, const float *x, float *y) { avx2_vector_sub_scaled(n, s, x, y); },
+            [](size_t d, const float *a, const float *b, float *c, size_t ldc) { avx2_gemm_kernel(d, a, b, c, ldc); });
+  }
+#endif
+  return check_result();
+}
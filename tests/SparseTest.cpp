@@ -0,0 +1,86 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <numeric>
+#include "Check.h"
+#include "../Rational.h"
+#include "../SparseMatrix.h"
+
+// Пятиточечный лапласиан на сетке side x side
+SparseMatrix<double> laplacian(size_t side) {
+  size_t n = side * side;
+  std::vector<SparseEntry<double>> entries;
+  for (size_t x = 0; x < side; x++) {
+    for (size_t y = 0; y < side; y++) {
+      size_t i = x * side + y;
+      entries.push_back({i, i, 4});
+      if (x > 0) entries.push_back({i, i - side, -1});
+      if (x + 1 < side) entries.push_back({i, i + side, -1});
+      if (y > 0) entries.push_back({i, i - 1, -1});
+      if (y + 1 < side) entries.push_back({i, i + 1, -1});
+    }
+  }
+  return SparseMatrix<double>(n, n, entries);
+}
+
+int main() {
+  // Повторяющиеся позиции складываются, нули выбрасываются
+  SparseMatrix<int> small(3, 2, {{0, 1, 2}, {1, 0, 5}, {0, 1, 3}, {1, 2, 1}, {1, 2, -1}});
+  CHECK(small.non_zeros() == 2);
+  CHECK(equal(small.dense(), Matrix<int>{{0, 5, 0}, {5, 0, 0}}));
+  CHECK(equal(small.transposed().dense(), small.dense().transposed()));
+
+  Matrix<double> dense = random_real_matrix<double>(40, 30, 1);
+  for (size_t i = 0; i < 40; i++) {
+    for (size_t j = 0; j < 30; j++) {
+      if ((i * 7 + j * 3) % 5 != 0) {
+        dense[i][j] = 0;
+      }
+    }
+  }
+  SparseMatrix<double> sparse(dense);
+  CHECK(equal(sparse.dense(), dense));
+  CHECK(equal(sparse.transposed().dense(), dense.transposed()));
+  Matrix<double> other = random_real_matrix<double>(30, 7, 2);
+  Matrix<double> product = naive_product(dense, other);
+  CHECK(max_difference(sparse * other, product) < 1e-13);
+  std::vector<double> vector(30), expected(40);
+  for (size_t j = 0; j < 30; j++) {
+    vector[j] = other[j][0];
+  }
+  for (size_t i = 0; i < 40; i++) {
+    expected[i] = product[i][0];
+  }
+  CHECK(max_difference(sparse * vector, expected) < 1e-13);
+
+  // Порядок минимальной степени даёт меньше заполнения, чем естественный
+  SparseMatrix<double> a = laplacian(30);
+  size_t n = a.vertical_size();
+  std::vector<double> b(n);
+  for (size_t i = 0; i < n; i++) {
+    b[i] = std::sin(double(i));
+  }
+  SparseLU<double> lu = a.lu();
+  CHECK(!lu.singular());
+  std::vector<double> x = lu.solve(b);
+  CHECK(residual(a.dense(), x, b) < 1e-12);
+  std::vector<size_t> natural(n);
+  std::iota(natural.begin(), natural.end(), 0);
+  SparseLU<double> natural_lu(a, natural);
+  CHECK(max_difference(natural_lu.solve(b), x) < 1e-12);
+  CHECK(lu.non_zeros() < natural_lu.non_zeros());
+
+  // Несимметричная матрица с нулём на диагонали требует перестановки строк
+  Matrix<Rational> exact{{0, 2, 0, 1}, {3, 0, 0, 0}, {0, 1, 4, 0}, {1, 0, Rational(1, 2), 5}};
+  std::vector<Rational> exact_b{1, 2, 3, 4};
+  std::vector<Rational> exact_x = SparseMatrix<Rational>(exact).solve(exact_b);
+  CHECK(exact_x.size() == 4);
+  CHECK(exact_x == exact.solve(exact_b));
+
+  SparseMatrix<double> singular(3, 3, {{0, 0, 1}, {1, 1, 1}, {2, 0, 2}});
+  CHECK(singular.lu().singular());
+  CHECK(singular.solve({1, 1, 1}).empty());
+  CHECK(SparseMatrix<double>(3, 2, {}).solve({1, 1}).empty());
+  return check_result();
+}
@@ -0,0 +1,42 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+int main() {
+  Matrix<int> a{{1, 2, 3}, {4, 5, 6}};
+  CHECK(a.vertical_size() == 2 && a.horizontal_size() == 3);
+  // Строки лежат подряд в одном буфере
+  CHECK(a.stride() == 3 && a[1] == a.data() + 3);
+  for (int i = 0; i < 6; i++) {
+    CHECK(a.data()[i] == i + 1);
+  }
+  CHECK(equal(a, Matrix<int>(std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}})));
+
+  Matrix<int> zeros(4, 3);
+  CHECK(zeros.vertical_size() == 3 && zeros.horizontal_size() == 4 && zeros[2][3] == 0);
+
+  Matrix<int> resized = a;
+  resized.resize_horizontally(4);
+  CHECK(equal(resized, Matrix<int>{{1, 2, 3, 0}, {4, 5, 6, 0}}));
+  resized.resize_vertically(3);
+  CHECK(equal(resized, Matrix<int>{{1, 2, 3, 0}, {4, 5, 6, 0}, {0, 0, 0, 0}}));
+  resized.resize_horizontally(2);
+  CHECK(equal(resized, Matrix<int>{{1, 2}, {4, 5}, {0, 0}}));
+
+  Matrix<int> big{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+  CHECK(equal(big.cutted(1, 1, 3, 3), Matrix<int>{{6, 7}, {10, 11}}));
+  CHECK(equal(big.cutted(2, 2), Matrix<int>{{1, 2}, {5, 6}}));
+  Matrix<int> cut = big;
+  cut.cut(0, 2, 3, 4);
+  CHECK(equal(cut, Matrix<int>{{3, 4}, {7, 8}, {11, 12}}));
+  CHECK(equal(Matrix<int>(big).cutted(1, 0, 2, 4), Matrix<int>{{5, 6, 7, 8}}));
+
+  CHECK(equal(a | Matrix<int>{{7}, {8}}, Matrix<int>{{1, 2, 3, 7}, {4, 5, 6, 8}}));
+  CHECK(equal(Matrix<int>{{1}} | Matrix<int>{{2}, {3}}, Matrix<int>{{1, 2}, {0, 3}}));
+
+  CHECK(equal(Identity<int>(2), Matrix<int>{{1, 0}, {0, 1}}));
+  CHECK(Matrix<int>().empty() && !a.empty());
+  return check_result();
+}
@@ -0,0 +1,43 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+#include "../ModInt.h"
+
+int main() {
+  set_strassen_crossover(16);
+  // Нечётные размеры отщепляются на каждом уровне рекурсии
+  size_t sizes[][3] = {{16, 16, 16}, {64, 64, 64}, {65, 63, 67}, {100, 37, 81}, {129, 130, 131}, {15, 200, 200}};
+  for (auto &size : sizes) {
+    size_t m = size[0], k = size[1], n = size[2];
+    Matrix<long long> a = random_matrix<long long>(m, k, -1000, 1000, m);
+    Matrix<long long> b = random_matrix<long long>(k, n, -1000, 1000, n);
+    CHECK(equal(a * b, naive_product(a, b)));
+
+    using Field = ModInt<998244353>;
+    Matrix<Field> modular_a = random_matrix<Field>(m, k, 0, 1 << 30, m);
+    Matrix<Field> modular_b = random_matrix<Field>(k, n, 0, 1 << 30, n);
+    CHECK(equal(modular_a * modular_b, naive_product(modular_a, modular_b)));
+
+    Matrix<double> real_a = random_real_matrix<double>(m, k, m);
+    Matrix<double> real_b = random_real_matrix<double>(k, n, n);
+    CHECK(max_difference(real_a * real_b, naive_product(real_a, real_b)) < 1e-12 * k);
+
+    // Блоки внутри большей матрицы с ненулевым результатом до умножения
+    Matrix<long long> big_c = random_matrix<long long>(m + 2, n + 3, -5, 5, 1);
+    Matrix<long long> outside = big_c;
+    multiply<long long>(big_c.view(1, 2, m + 1, n + 2), a.view(), b.view());
+    CHECK(equal(Matrix<long long>(big_c.view(1, 2, m + 1, n + 2)), naive_product(a, b)));
+    big_c.view(1, 2, m + 1, n + 2) = outside.view(1, 2, m + 1, n + 2);
+    CHECK(equal(big_c, outside));
+  }
+
+  set_strassen_crossover(0);
+  Matrix<long long> a = random_matrix<long long>(70, 70, -1000, 1000, 3);
+  Matrix<long long> ordinary = a * a;
+  set_strassen_crossover(8);
+  CHECK(equal(a * a, ordinary));
+  set_strassen_crossover(0);
+  return check_result();
+}
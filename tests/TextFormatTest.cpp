@@ -0,0 +1,81 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <sstream>
+#include "Check.h"
+#include "../TextFormat.h"
+
+template<typename T>
+bool round_trips(const T &value) {
+  T parsed{};
+  return from_text(to_text(value), parsed) && parsed == value;
+}
+
+template<typename T>
+bool matrix_round_trips(const Matrix<T> &value) {
+  Matrix<T> parsed;
+  return from_text(to_text(value), parsed) && equal(parsed, value);
+}
+
+template<typename T>
+std::string streamed(const T &value) {
+  std::ostringstream out;
+  out << value;
+  return out.str();
+}
+
+int main() {
+  // Кратчайшая запись double читается обратно в то же число
+  for (double value : {0.0, 0.1, -2.5, 1e-300, 1e300, 123456789.123456789, 4.9e-324}) {
+    CHECK(round_trips(value));
+  }
+  CHECK(to_text(0.1) == "0.1");
+  CHECK(round_trips(-9223372036854775807LL - 1));
+  CHECK(round_trips(Rational(-7, 12)));
+  CHECK(round_trips(ModInt<998244353>(998244352)));
+  CHECK(round_trips(Polynomial<Rational>({Rational(-18), Rational(1, 2), Rational(-9), Rational(1)})));
+  CHECK(round_trips(Polynomial<int>({0, -1})));
+  CHECK(round_trips(Polynomial<int>()));
+  Permutation permutation(4);
+  CHECK(from_text(to_text(Permutation({2, 0, 3, 1})), permutation) && permutation == Permutation({2, 0, 3, 1}));
+
+  // Текст совпадает с выводом operator<<
+  Matrix<int> small{{1, -2}, {30, 4}};
+  CHECK(to_text(small) == "((1, -2),\n(30, 4))");
+  CHECK(to_text(small) == streamed(small));
+  CHECK(to_text(Rational(-7, 12)) == streamed(Rational(-7, 12)));
+  CHECK(to_text(Polynomial<int>({1, 0, -9, 1})) == streamed(Polynomial<int>({1, 0, -9, 1})));
+
+  CHECK(matrix_round_trips(Matrix<int>()));
+  CHECK(matrix_round_trips(random_matrix<Rational>(5, 7, -100, 100, 1)));
+  // Большая матрица пишется параллельно полосами
+  CHECK(matrix_round_trips(random_real_matrix<double>(300, 300, 2)));
+  CHECK(matrix_round_trips(Matrix<double>(random_real_matrix<double>(70, 5, 3).view(10, 1, 60, 4))));
+
+  // Матрицы фиксированного размера и разреженные
+  FixedMatrix<Rational, 2, 3> fixed{{Rational(1, 2), 0, -3}, {4, Rational(-5, 7), 6}};
+  FixedMatrix<Rational, 2, 3> fixed_parsed;
+  CHECK(to_text(fixed) == streamed(fixed));
+  CHECK(from_text(to_text(fixed), fixed_parsed) && fixed_parsed == fixed);
+  FixedMatrix<Rational, 3, 2> transposed_parsed;
+  CHECK(!from_text(to_text(fixed), transposed_parsed));
+  SparseMatrix<double> sparse(6, 5, {{0, 3, 0.1}, {2, 0, -2.5}, {2, 5, 1e300}, {4, 4, 3}});
+  CHECK(to_text(sparse) == streamed(sparse));
+  SparseMatrix<double> sparse_parsed(Matrix<double>(6, 5));
+  CHECK(from_text(to_text(sparse), sparse_parsed) && equal(sparse_parsed.dense(), sparse.dense()));
+  CHECK(from_text("()", sparse_parsed) && sparse_parsed.size() == sparse.size() && sparse_parsed.values().empty());
+  CHECK(!from_text("((5, 0): 1)", sparse_parsed));
+  CHECK(!from_text("((0, 1) 1)", sparse_parsed));
+
+  Matrix<int> parsed;
+  CHECK(from_text("  (( 1 ,2 ),\n ( 3, 4 ))  ", parsed) && equal(parsed, Matrix<int>{{1, 2}, {3, 4}}));
+  CHECK(!from_text("((1, 2), (3))", parsed));
+  CHECK(!from_text("((1, 2), (3, 4)", parsed));
+  CHECK(!from_text("((1, 2)) x", parsed));
+  CHECK(!from_text("((1, a))", parsed));
+  Rational rational;
+  CHECK(!from_text("1/0", rational));
+  CHECK(!from_text(to_text(Permutation({0, 0, 1})), permutation));
+  return check_result();
+}
@@ -0,0 +1,64 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include <atomic>
+#include <stdexcept>
+#include "Check.h"
+
+int main() {
+  set_thread_count(4);
+  CHECK(thread_count() == 4);
+
+  // Каждый индекс обрабатывается ровно один раз
+  std::vector<std::atomic<int>> visits(10007);
+  parallel_for(0, visits.size(), 13, [&](size_t first, size_t last) {
+    CHECK(first < last && last - first <= 13);
+    for (size_t i = first; i < last; i++) {
+      visits[i]++;
+    }
+  });
+  bool once = true;
+  for (auto &count : visits) {
+    once = once && count == 1;
+  }
+  CHECK(once);
+
+  // Вложенный вызов выполняется на месте
+  std::atomic<size_t> total(0);
+  parallel_for(0, 64, 1, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      parallel_for(0, 100, 7, [&](size_t inner_first, size_t inner_last) {
+        total += inner_last - inner_first;
+      });
+    }
+  });
+  CHECK(total == 6400);
+
+  bool caught = false;
+  try {
+    parallel_for(0, 1000, 1, [&](size_t first, size_t) {
+      if (first == 500) {
+        throw std::runtime_error("chunk");
+      }
+    });
+  } catch (const std::runtime_error &) {
+    caught = true;
+  }
+  CHECK(caught);
+
+  // Результаты с потоками совпадают с однопоточными
+  Matrix<double> a = random_matrix<double>(300, 200, -9, 9, 1);
+  Matrix<double> b = random_matrix<double>(200, 250, -9, 9, 2);
+  Matrix<double> square = random_real_matrix<double>(150, 150, 3);
+  Matrix<double> parallel_product = a;
+  parallel_product *= b;
+  Matrix<double> parallel_gauss = square.gauss();
+  set_thread_count(1);
+  CHECK(thread_count() == 1);
+  Matrix<double> serial_product = a;
+  serial_product *= b;
+  CHECK(equal(parallel_product, serial_product));
+  CHECK(equal(parallel_gauss, square.gauss()));
+  return check_result();
+}
@@ -0,0 +1,74 @@
+//
+// Created by livace on 17.10.2026.
+//
+
+#include "Check.h"
+
+// Транспонирование по определению
+template<typename T>
+Matrix<T> naive_transposed(const Matrix<T> &a) {
+  Matrix<T> result(a.vertical_size(), a.horizontal_size());
+  for (size_t i = 0; i < a.vertical_size(); i++) {
+    for (size_t j = 0; j < a.horizontal_size(); j++) {
+      result[j][i] = a[i][j];
+    }
+  }
+  return result;
+}
+
+int main() {
+  for (size_t n : {1, 5, 32, 33, 100, 300}) {
+    Matrix<int> a = random_matrix<int>(n, n, -100, 100, n);
+    Matrix<int> expected = naive_transposed(a);
+    Matrix<int> square = a;
+    square.transpose();
+    CHECK(equal(square, expected));
+    CHECK(equal(a.transposed(), expected));
+
+    Matrix<int> rectangular = random_matrix<int>(n, n / 2 + 3, -100, 100, n);
+    CHECK(equal(rectangular.transposed(), naive_transposed(rectangular)));
+    Matrix<int> copy = rectangular;
+    copy.transpose();
+    CHECK(equal(copy, naive_transposed(rectangular)));
+
+    // Выражения, которые читают матрицу-приёмник по другим индексам
+    Matrix<int> s = a;
+    s = s.transposed_view();
+    CHECK(equal(s, expected));
+    s = a;
+    s = s.transposed_view() + s;
+    CHECK(equal(s, (expected + a).eval()));
+    s = a;
+    s += s.transposed_view();
+    CHECK(equal(s, (a + expected).eval()));
+    s = a;
+    s -= s.transposed_view() * 2;
+    CHECK(equal(s, (a - expected * 2).eval()));
+    s = a;
+    s.view() = -s.transposed_view();
+    CHECK(equal(s, (-expected).eval()));
+    s = a;
+    s *= s.transposed_view();
+    CHECK(equal(s, naive_product(a, expected)));
+  }
+
+  // Сдвинутые пересекающиеся блоки одной матрицы
+  Matrix<int> a = random_matrix<int>(10, 10, -100, 100, 1);
+  Matrix<int> shifted = a;
+  shifted.view(1, 0, 10, 10) = shifted.view(0, 0, 9, 10);
+  CHECK(equal(Matrix<int>(shifted.view(1, 0, 10, 10)), Matrix<int>(a.view(0, 0, 9, 10))));
+  shifted = a;
+  shifted.view(0, 1, 10, 10) += shifted.view(0, 0, 10, 9);
+  CHECK(equal(Matrix<int>(shifted.view(0, 1, 10, 10)), Matrix<int>(a.view(0, 1, 10, 10) + a.view(0, 0, 10, 9))));
+  shifted = a;
+  shifted.view(0, 0, 9, 9) = shifted.view(1, 1, 10, 10).transposed();
+  CHECK(equal(Matrix<int>(shifted.view(0, 0, 9, 9)), Matrix<int>(a.view(1, 1, 10, 10).transposed())));
+
+  // Выражения другого типа элементов: проверка пересечения сравнивает адреса, а не указатели разных типов
+  Matrix<double> wide = random_matrix<double>(6, 9, -100, 100, 2);
+  Matrix<float> narrow(wide);
+  CHECK(equal(narrow, random_matrix<float>(6, 9, -100, 100, 2)));
+  narrow.view() = (wide.transposed() * 2.0).transposed();
+  CHECK(equal(Matrix<double>(narrow), (wide * 2.0).eval()));
+  return check_result();
+}